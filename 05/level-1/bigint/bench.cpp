@@ -0,0 +1,697 @@
+#include "bigint.hpp"
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <map>
+#if __cplusplus >= 201103L
+# include <unordered_map>
+#endif
+
+/**
+ * @file bench.cpp
+ * @brief Microbenchmarks de bigint y control de regresiones de rendimiento
+ *
+ * Mide suma, incremento, desplazamientos, comparación, multiplicación,
+ * división y conversión a texto con operandos de 1 a 10^7 dígitos. Los
+ * resultados se pueden guardar en JSON o CSV y, con --baseline, se comparan
+ * con una ejecución anterior: si alguna operación es más lenta de lo que
+ * permite la tolerancia, el programa termina con código 1.
+ *
+ * Compilar y ejecutar:
+ *     c++ -O2 bench.cpp bigint.cpp -o bench
+ *     ./bench --json base.json                     # guarda una referencia
+ *     ./bench --baseline base.json --tolerance 0.2 # falla si algo empeora un 20%
+ *     ./bench --ops mul,div --max-digits 100000    # solo parte de la tabla
+ *     ./bench --simd                               # suma/resta escalar frente a AVX2
+ *     ./bench --hash                               # std::map frente a unordered_map
+ *     ./bench --crossover                          # barrido de los umbrales de '*'
+ *
+ * Todo se mide en un solo hilo (setThreadCount(1)) con tiempo de CPU: el
+ * mejor de tres muestras de al menos --min-time segundos cada una.
+ */
+
+// ==================== OPCIONES ====================
+
+struct options
+{
+	size_t maxDigits;           // Tamaño máximo de operando
+	double minTime;             // Segundos mínimos por muestra
+	double tolerance;           // Empeoramiento admitido frente a la referencia
+	std::string ops;            // Operaciones separadas por comas (vacío: todas)
+	std::string jsonPath;       // Salida JSON
+	std::string csvPath;        // Salida CSV
+	std::string baselinePath;   // Referencia (JSON o CSV de este programa)
+	bool simd;                  // Comparación escalar/AVX2 en lugar de la tabla
+	bool hash;                  // Comparación de mapas en lugar de la tabla
+	bool crossover;             // Barrido de umbrales de multiplicación
+};
+
+/**
+ * @brief Resultado de una operación en un tamaño
+ */
+struct result
+{
+	std::string op;
+	size_t digits;
+	double ns;                  // Nanosegundos por operación
+	size_t reps;                // Repeticiones por muestra
+};
+
+static const char* const OPS[] = { "add", "inc", "shl_dec", "shl_bin", "cmp", "mul", "div", "str" };
+static const size_t OP_COUNT = sizeof(OPS) / sizeof(OPS[0]);
+
+static const size_t SIZES[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000 };
+static const size_t SIZE_COUNT = sizeof(SIZES) / sizeof(SIZES[0]);
+
+static const size_t SAMPLES = 3;
+
+// Evita que el compilador elimine las operaciones medidas
+static volatile size_t sink = 0;
+
+// ==================== UTILIDADES ====================
+
+/**
+ * @brief Genera un bigint pseudoaleatorio de exactamente 'limbs' limbs
+ * Se construye deserializando bytes de un LCG fijo, que es instantáneo
+ * @param limbs Número de limbs (>= 1; el más alto nunca es 0)
+ * @param seed Semilla del generador
+ * @return bigint generado
+ */
+static bigint randomLimbs(size_t limbs, uint32_t seed)
+{
+	bigint value;
+	std::vector<unsigned char> bytes;
+	for(size_t n = limbs; ; n >>= 7)
+	{
+		bytes.push_back((unsigned char)((n & 0x7F) | (n >= 0x80 ? 0x80 : 0)));
+		if(n < 0x80)
+			break;
+	}
+	for(size_t i = 0; i < 4 * limbs; i++)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		bytes.push_back((unsigned char)(seed >> 24));
+	}
+	bytes.back() |= 0x80;  // Limb alto distinto de 0
+	bigint::deserialize(&bytes[0], bytes.size(), value);
+	return(value);
+}
+
+/**
+ * @brief Genera un bigint pseudoaleatorio de unos 'digits' dígitos
+ * Un LCG fijo, así todas las ejecuciones miden los mismos datos. Hasta 10^5
+ * dígitos se construye desde texto (dígitos exactos); por encima, desde
+ * limbs aleatorios
+ * @param digits Número de dígitos decimales
+ * @param seed Semilla del generador
+ * @return bigint generado
+ */
+static bigint randomBigint(size_t digits, uint32_t seed)
+{
+	if(digits <= 100000)
+	{
+		std::string text(digits, '0');
+		for(size_t i = 0; i < digits; i++)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			text[i] = (char)('0' + (seed >> 24) % 10);
+		}
+		text[0] = '9';
+		return(bigint(text));
+	}
+	// log2(10) / 32 limbs por dígito
+	return(randomLimbs((size_t)((double)digits * 0.10381025296523008), seed));
+}
+
+/**
+ * @brief Segundos de CPU entre dos lecturas de clock()
+ */
+static double seconds(clock_t start, clock_t end)
+{
+	return((double)(end - start) / CLOCKS_PER_SEC);
+}
+
+// ==================== OPERACIONES ====================
+
+/**
+ * @brief Operandos de un tamaño
+ */
+struct operands
+{
+	bigint a;                   // 'digits' dígitos
+	bigint b;                   // Uno menos
+	bigint next;                // a + 1: la comparación recorre todos los limbs
+	bigint divisor;             // La mitad de dígitos
+};
+
+/**
+ * @brief Ejecuta reps veces una operación
+ * @return Segundos de CPU
+ */
+static double runOp(size_t op, const operands& x, size_t reps)
+{
+	bigint r;
+	size_t acc = 0;
+	clock_t start = clock();
+	switch(op)
+	{
+		case 0:
+			for(size_t i = 0; i < reps; i++)
+			{
+				r = x.a + x.b;
+				acc += r.bitLength();
+			}
+			break;
+		case 1:
+			r = x.a;
+			for(size_t i = 0; i < reps; i++)
+				++r;
+			acc += r.bitLength();
+			break;
+		case 2:
+			for(size_t i = 0; i < reps; i++)
+			{
+				r = x.a << 10;
+				acc += r.bitLength();
+			}
+			break;
+		case 3:
+			for(size_t i = 0; i < reps; i++)
+			{
+				r = x.a;
+				r.shiftLeftBits(37);
+				acc += r.bitLength();
+			}
+			break;
+		case 4:
+			for(size_t i = 0; i < reps; i++)
+				acc += (size_t)(x.a.compare(x.next) + 1);
+			break;
+		case 5:
+			for(size_t i = 0; i < reps; i++)
+			{
+				r = x.a * x.b;
+				acc += r.bitLength();
+			}
+			break;
+		case 6:
+			for(size_t i = 0; i < reps; i++)
+			{
+				r = x.a / x.divisor;
+				acc += r.bitLength();
+			}
+			break;
+		default:
+			for(size_t i = 0; i < reps; i++)
+				acc += x.a.getStr().size();
+			break;
+	}
+	clock_t end = clock();
+	sink = sink + acc;
+	return(seconds(start, end));
+}
+
+/**
+ * @brief Mide una operación: calibra las repeticiones hasta llegar a
+ * minTime y se queda con la mejor de SAMPLES muestras
+ * Si una sola ejecución ya pasa de un segundo no se repite más
+ */
+static result measure(size_t op, size_t digits, const operands& x, double minTime)
+{
+	size_t reps = 1;
+	double t = runOp(op, x, reps);
+	while(t < minTime)
+	{
+		double factor = (t > 0) ? minTime / t * 1.2 : 10.0;
+		reps = (size_t)((double)reps * std::min(std::max(factor, 2.0), 10.0));
+		t = runOp(op, x, reps);
+	}
+	double best = t;
+	if(t < 1.0)
+	{
+		for(size_t s = 1; s < SAMPLES; s++)
+			best = std::min(best, runOp(op, x, reps));
+	}
+	result res;
+	res.op = OPS[op];
+	res.digits = digits;
+	res.ns = best * 1e9 / (double)reps;
+	res.reps = reps;
+	return(res);
+}
+
+/**
+ * @brief Indica si op está en la lista separada por comas (vacía: todas)
+ */
+static bool selected(const std::string& list, const char* op)
+{
+	if(list.empty())
+		return(true);
+	std::string padded = "," + list + ",";
+	return(padded.find("," + std::string(op) + ",") != std::string::npos);
+}
+
+// ==================== SALIDA ====================
+
+static void writeJson(const std::string& path, const std::vector<result>& results)
+{
+	std::ofstream out(path.c_str());
+	out << "[\n";
+	for(size_t i = 0; i < results.size(); i++)
+	{
+		char line[160];
+		std::sprintf(line, "  {\"op\": \"%s\", \"digits\": %lu, \"ns\": %.3f, \"reps\": %lu}%s\n",
+			results[i].op.c_str(), (unsigned long)results[i].digits, results[i].ns,
+			(unsigned long)results[i].reps, (i + 1 < results.size()) ? "," : "");
+		out << line;
+	}
+	out << "]\n";
+}
+
+static void writeCsv(const std::string& path, const std::vector<result>& results)
+{
+	std::ofstream out(path.c_str());
+	out << "op,digits,ns,reps\n";
+	for(size_t i = 0; i < results.size(); i++)
+	{
+		char line[128];
+		std::sprintf(line, "%s,%lu,%.3f,%lu\n", results[i].op.c_str(),
+			(unsigned long)results[i].digits, results[i].ns, (unsigned long)results[i].reps);
+		out << line;
+	}
+}
+
+/**
+ * @brief Valor de un campo en una línea JSON de writeJson
+ * @return Texto del valor (sin comillas), vacío si no está
+ */
+static std::string jsonField(const std::string& line, const std::string& key)
+{
+	size_t pos = line.find("\"" + key + "\":");
+	if(pos == std::string::npos)
+		return("");
+	pos += key.size() + 3;
+	while(pos < line.size() && (line[pos] == ' ' || line[pos] == '"'))
+		pos++;
+	size_t end = line.find_first_of("\",}", pos);
+	return(line.substr(pos, end - pos));
+}
+
+/**
+ * @brief Lee una referencia escrita por writeJson o writeCsv
+ * @return Nanosegundos por operación, indexados por "op/dígitos"
+ */
+static std::map<std::string, double> readBaseline(const std::string& path)
+{
+	std::map<std::string, double> base;
+	std::ifstream in(path.c_str());
+	if(!in)
+	{
+		std::fprintf(stderr, "no se puede leer la referencia %s\n", path.c_str());
+		std::exit(2);
+	}
+	std::string line;
+	while(std::getline(in, line))
+	{
+		std::string op;
+		std::string digits;
+		std::string ns;
+		if(line.find('{') != std::string::npos)
+		{
+			op = jsonField(line, "op");
+			digits = jsonField(line, "digits");
+			ns = jsonField(line, "ns");
+		}
+		else
+		{
+			size_t c1 = line.find(',');
+			size_t c2 = (c1 == std::string::npos) ? c1 : line.find(',', c1 + 1);
+			size_t c3 = (c2 == std::string::npos) ? c2 : line.find(',', c2 + 1);
+			if(c2 == std::string::npos || line.compare(0, c1, "op") == 0)
+				continue;
+			op = line.substr(0, c1);
+			digits = line.substr(c1 + 1, c2 - c1 - 1);
+			ns = line.substr(c2 + 1, c3 - c2 - 1);
+		}
+		if(!op.empty() && !digits.empty() && !ns.empty())
+			base[op + "/" + digits] = std::atof(ns.c_str());
+	}
+	return(base);
+}
+
+// ==================== COMPARACIÓN ESCALAR / AVX2 ====================
+
+/**
+ * @brief Mide el tiempo medio de r = a; r += b (o r -= b)
+ * @param a Primer operando (el mayor)
+ * @param b Segundo operando
+ * @param reps Número de repeticiones
+ * @param subtract true para medir la resta
+ * @return Nanosegundos por operación
+ */
+static double timeAddSub(const bigint& a, const bigint& b, size_t reps, bool subtract)
+{
+	bigint r;
+	clock_t start = clock();
+	for(size_t i = 0; i < reps; i++)
+	{
+		r = a;
+		if(subtract)
+			r -= b;
+		else
+			r += b;
+	}
+	clock_t end = clock();
+	return(seconds(start, end) * 1e9 / reps);
+}
+
+static void runSimdComparison()
+{
+	static const size_t SIMD_SIZES[] = {100, 1000, 10000, 100000, 1000000};
+
+	std::printf("AVX2 disponible: %s\n", bigint::simdAvailable() ? "si" : "no");
+	std::printf("%4s %10s %14s %14s %8s\n", "op", "digitos", "escalar (ns)", "simd (ns)", "ratio");
+	for(int subtract = 0; subtract < 2; subtract++)
+	{
+		for(size_t i = 0; i < sizeof(SIMD_SIZES) / sizeof(SIMD_SIZES[0]); i++)
+		{
+			bigint a = randomBigint(SIMD_SIZES[i], 1);
+			bigint b = randomBigint(SIMD_SIZES[i] - 1, 2);
+			size_t reps = 20000000 / SIMD_SIZES[i] + 1;
+
+			bigint::simd_enabled = false;
+			double scalar = timeAddSub(a, b, reps, subtract != 0);
+			bigint::simd_enabled = true;
+			double simd = timeAddSub(a, b, reps, subtract != 0);
+			std::printf("%4s %10lu %14.1f %14.1f %8.2f\n", subtract ? "-" : "+",
+				(unsigned long)SIMD_SIZES[i], scalar, simd, scalar / simd);
+		}
+	}
+}
+
+// ==================== CLAVES EN MAPAS ====================
+
+#if __cplusplus >= 201103L
+/**
+ * @brief Lo que había que hacer antes de std::hash<bigint>: hashear el texto
+ */
+struct textHash
+{
+	size_t operator()(const bigint& value) const
+	{
+		return(std::hash<std::string>()(value.getStr()));
+	}
+};
+
+/**
+ * @brief Inserta todas las claves y las busca todas en otro orden
+ * @param keys Claves a insertar
+ * @param probes Claves a buscar (las mismas, barajadas)
+ * @param insertNs Recibe los nanosegundos por inserción
+ * @param findNs Recibe los nanosegundos por búsqueda
+ */
+template <class Map>
+static void timeMap(const std::vector<bigint>& keys, const std::vector<bigint>& probes,
+	double& insertNs, double& findNs)
+{
+	Map m;
+	clock_t start = clock();
+	for(size_t i = 0; i < keys.size(); i++)
+		m[keys[i]] = i;
+	clock_t mid = clock();
+	size_t acc = 0;
+	for(size_t i = 0; i < probes.size(); i++)
+		acc += m.find(probes[i])->second;
+	clock_t end = clock();
+	sink = sink + acc;
+	insertNs = seconds(start, mid) * 1e9 / keys.size();
+	findNs = seconds(mid, end) * 1e9 / probes.size();
+}
+
+static void runHashComparison()
+{
+	static const size_t KEY_DIGITS[] = {20, 100, 1000, 10000};
+
+	std::printf("%8s %8s %24s %24s %24s\n", "digitos", "claves",
+		"std::map ins/find (ns)", "hash ins/find (ns)", "getStr ins/find (ns)");
+	for(size_t d = 0; d < sizeof(KEY_DIGITS) / sizeof(KEY_DIGITS[0]); d++)
+	{
+		size_t digits = KEY_DIGITS[d];
+		size_t count = std::min((size_t)200000, 20000000 / digits);
+		std::vector<bigint> keys;
+		keys.reserve(count);
+		for(size_t i = 0; i < count; i++)
+			keys.push_back(randomBigint(digits, (uint32_t)(i * 2654435761u + 1)));
+		// Mismas claves en otro orden y en otros objetos: nada de punteros iguales
+		std::vector<bigint> probes(keys);
+		uint32_t seed = 12345;
+		for(size_t i = probes.size(); i > 1; i--)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			std::swap(probes[i - 1], probes[seed % i]);
+		}
+		double t[6];
+		timeMap<std::map<bigint, size_t> >(keys, probes, t[0], t[1]);
+		timeMap<std::unordered_map<bigint, size_t> >(keys, probes, t[2], t[3]);
+		timeMap<std::unordered_map<bigint, size_t, textHash> >(keys, probes, t[4], t[5]);
+		std::printf("%8lu %8lu %11.1f /%11.1f %11.1f /%11.1f %11.1f /%11.1f\n",
+			(unsigned long)digits, (unsigned long)count, t[0], t[1], t[2], t[3], t[4], t[5]);
+	}
+}
+#endif
+
+// ==================== UMBRALES DE MULTIPLICACIÓN ====================
+
+/**
+ * @brief Un umbral de mulLimbs y los dos niveles que separa
+ */
+struct tier
+{
+	const char* lower;          // Algoritmo por debajo del umbral
+	const char* upper;          // Algoritmo a partir del umbral
+	size_t* threshold;          // bigint::*_threshold
+};
+
+/**
+ * @brief Nanosegundos de a * b: mejor de SAMPLES muestras de al menos minTime
+ */
+static double timeMul(const bigint& a, const bigint& b, double minTime)
+{
+	size_t reps = 1;
+	double best = 0;
+	for(size_t s = 0; s < SAMPLES; s++)
+	{
+		double t;
+		for(;;)
+		{
+			size_t acc = 0;
+			clock_t start = clock();
+			for(size_t i = 0; i < reps; i++)
+				acc += (a * b).bitLength();
+			t = seconds(start, clock());
+			sink = sink + acc;
+			if(t >= minTime)
+				break;
+			reps *= 2;
+		}
+		double ns = t * 1e9 / (double)reps;
+		if(s == 0 || ns < best)
+			best = ns;
+	}
+	return(best);
+}
+
+/**
+ * @brief Barre tamaños alrededor de cada umbral y mide los dos niveles
+ * Con el umbral por encima del tamaño se mide el nivel inferior; con el
+ * umbral igual al tamaño, el superior en el primer nivel de la recursión
+ * (los subproductos, más pequeños, siguen con el nivel inferior). El cruce
+ * es el primer tamaño a partir del cual el nivel superior siempre gana
+ */
+static void runCrossover(double minTime)
+{
+	static const double FACTORS[] = { 0.25, 0.5, 0.75, 1.0, 1.25, 1.5, 2.0, 3.0, 4.0 };
+	static const size_t FACTOR_COUNT = sizeof(FACTORS) / sizeof(FACTORS[0]);
+	tier tiers[] = {
+		{ "escolar", "karatsuba", &bigint::karatsuba_threshold },
+		{ "karatsuba", "toom3", &bigint::toom3_threshold },
+		{ "toom3", "ntt", &bigint::ntt_threshold }
+	};
+
+	bigint::setThreadCount(1);
+	for(size_t t = 0; t < sizeof(tiers) / sizeof(tiers[0]); t++)
+	{
+		size_t current = *tiers[t].threshold;
+		size_t crossing = 0;
+		std::printf("%s -> %s (umbral actual %lu limbs)\n", tiers[t].lower, tiers[t].upper,
+			(unsigned long)current);
+		std::printf("%10s %16s %16s %8s\n", "limbs", tiers[t].lower, tiers[t].upper, "ratio");
+		for(size_t f = 0; f < FACTOR_COUNT; f++)
+		{
+			size_t limbs = (size_t)((double)current * FACTORS[f]);
+			bigint a = randomLimbs(limbs, 1);
+			bigint b = randomLimbs(limbs, 2);
+			*tiers[t].threshold = limbs + 1;
+			double lower = timeMul(a, b, minTime);
+			*tiers[t].threshold = limbs;
+			double upper = timeMul(a, b, minTime);
+			*tiers[t].threshold = current;
+			std::printf("%10lu %16.1f %16.1f %8.2f\n", (unsigned long)limbs, lower, upper, lower / upper);
+			if(upper < lower && crossing == 0)
+				crossing = limbs;
+			else if(upper >= lower)
+				crossing = 0;
+			std::fflush(stdout);
+		}
+		if(crossing != 0)
+			std::printf("cruce medido: ~%lu limbs\n\n", (unsigned long)crossing);
+		else
+			std::printf("cruce medido: por encima de %lu limbs\n\n",
+				(unsigned long)((double)current * FACTORS[FACTOR_COUNT - 1]));
+	}
+}
+
+// ==================== MAIN ====================
+
+static void usage()
+{
+	std::fprintf(stderr,
+		"uso: bench [--max-digits N] [--min-time S] [--ops add,inc,...]\n"
+		"             [--json FICHERO] [--csv FICHERO]\n"
+		"             [--baseline FICHERO] [--tolerance T] | --simd | --hash\n"
+		"             | --crossover [--min-time S]\n"
+		"operaciones: add inc shl_dec shl_bin cmp mul div str\n");
+	std::exit(2);
+}
+
+static options parseOptions(int argc, char** argv)
+{
+	options opt;
+	opt.maxDigits = 10000000;
+	opt.minTime = 0.1;
+	opt.tolerance = 0.25;
+	opt.simd = false;
+	opt.hash = false;
+	opt.crossover = false;
+	for(int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if(arg == "--simd")
+		{
+			opt.simd = true;
+			continue;
+		}
+		if(arg == "--hash")
+		{
+			opt.hash = true;
+			continue;
+		}
+		if(arg == "--crossover")
+		{
+			opt.crossover = true;
+			continue;
+		}
+		if(i + 1 >= argc)
+			usage();
+		std::string value = argv[++i];
+		if(arg == "--max-digits")
+			opt.maxDigits = (size_t)std::strtoul(value.c_str(), NULL, 10);
+		else if(arg == "--min-time")
+			opt.minTime = std::atof(value.c_str());
+		else if(arg == "--tolerance")
+			opt.tolerance = std::atof(value.c_str());
+		else if(arg == "--ops")
+			opt.ops = value;
+		else if(arg == "--json")
+			opt.jsonPath = value;
+		else if(arg == "--csv")
+			opt.csvPath = value;
+		else if(arg == "--baseline")
+			opt.baselinePath = value;
+		else
+			usage();
+	}
+	return(opt);
+}
+
+int main(int argc, char** argv)
+{
+	options opt = parseOptions(argc, argv);
+	if(opt.simd)
+	{
+		runSimdComparison();
+		return(0);
+	}
+	if(opt.crossover)
+	{
+		runCrossover(opt.minTime);
+		return(0);
+	}
+	if(opt.hash)
+	{
+#if __cplusplus >= 201103L
+		runHashComparison();
+		return(0);
+#else
+		std::fprintf(stderr, "--hash necesita C++11 (std::unordered_map)\n");
+		return(2);
+#endif
+	}
+
+	bigint::setThreadCount(1);
+	std::map<std::string, double> base;
+	if(!opt.baselinePath.empty())
+		base = readBaseline(opt.baselinePath);
+
+	std::printf("%-8s %10s %16s %10s", "op", "digitos", "ns/op", "reps");
+	if(!base.empty())
+		std::printf(" %16s %8s", "referencia", "ratio");
+	std::printf("\n");
+
+	std::vector<result> results;
+	size_t regressions = 0;
+	for(size_t s = 0; s < SIZE_COUNT && SIZES[s] <= opt.maxDigits; s++)
+	{
+		size_t digits = SIZES[s];
+		operands x;
+		x.a = randomBigint(digits, 1);
+		x.b = randomBigint(digits > 1 ? digits - 1 : 1, 2);
+		x.next = x.a + bigint(1);
+		x.divisor = randomBigint(digits > 1 ? digits / 2 : 1, 3);
+		for(size_t op = 0; op < OP_COUNT; op++)
+		{
+			if(!selected(opt.ops, OPS[op]))
+				continue;
+			result res = measure(op, digits, x, opt.minTime);
+			results.push_back(res);
+			std::printf("%-8s %10lu %16.1f %10lu", res.op.c_str(), (unsigned long)digits,
+				res.ns, (unsigned long)res.reps);
+			char key[64];
+			std::sprintf(key, "%s/%lu", res.op.c_str(), (unsigned long)digits);
+			std::map<std::string, double>::const_iterator it = base.find(key);
+			if(it != base.end() && it->second > 0)
+			{
+				double ratio = res.ns / it->second;
+				bool slower = ratio > 1.0 + opt.tolerance;
+				std::printf(" %16.1f %8.2f%s", it->second, ratio, slower ? "  REGRESION" : "");
+				if(slower)
+					regressions++;
+			}
+			std::printf("\n");
+			std::fflush(stdout);
+		}
+	}
+
+	if(!opt.jsonPath.empty())
+		writeJson(opt.jsonPath, results);
+	if(!opt.csvPath.empty())
+		writeCsv(opt.csvPath, results);
+	if(regressions > 0)
+	{
+		std::printf("%lu regresiones (tolerancia %.0f%%)\n", (unsigned long)regressions,
+			opt.tolerance * 100);
+		return(1);
+	}
+	return(0);
+}
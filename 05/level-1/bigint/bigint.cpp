@@ -1,209 +1,3354 @@
 #include "bigint.hpp"
 
+// Núcleo de suma AVX2: solo con GCC/Clang en x86, donde se puede compilar
+// una función para AVX2 aunque el resto del binario no lo use y elegirla en
+// tiempo de ejecución según la CPU
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define BIGINT_HAS_AVX2_KERNEL
+# include <immintrin.h>
+#endif
+
+// Multiplicación en paralelo: el pool de hilos necesita std::thread (C++11).
+// En C++98 todo se ejecuta en el hilo que llama
+#if __cplusplus >= 201103L
+# define BIGINT_HAS_THREADS
+# include "work_stealing_pool.hpp"
+#endif
+
+// ==================== CONSTANTES ====================
+
+// Mayor potencia de 10 que cabe en un limb: se usa para pasar de binario a
+// decimal (y para multiplicar/dividir por 10^n) en bloques de 9 dígitos
+typedef bigint::limb limb;
+
+static const limb DECIMAL_BASE = 1000000000u;
+static const unsigned int DECIMAL_BASE_DIGITS = 9;
+
+// ==================== MEMORIA POR HILO (ARENA Y CACHÉ DE BLOQUES) ====================
+
+// Cada hilo tiene su propia memoria: no hay locks ni contención en malloc
+// para los temporales. En C++11 se libera sola al terminar el hilo; con
+// __thread (C++98 en GCC/Clang) hay que llamar a bigint::releaseThreadMemory()
+// antes de que el hilo acabe; sin ninguna de las dos es una sola instancia
+// global (solo para programas de un hilo)
+#if __cplusplus >= 201103L
+# define BIGINT_TLS thread_local
+#elif defined(__GNUC__)
+# define BIGINT_TLS __thread
+#else
+# define BIGINT_TLS
+#endif
+
+// Bloques de limb_buffer que se guardan para reutilizar: capacidades 8 << c
+// para c < BLOCK_CLASSES (de 8 a 64K limbs), como mucho BLOCKS_PER_CLASS
+static const size_t BLOCK_CLASSES = 14;
+static const size_t BLOCKS_PER_CLASS = 8;
+static const size_t BLOCK_MIN_LIMBS = 8;
+static const size_t BLOCK_MAX_LIMBS = BLOCK_MIN_LIMBS << (BLOCK_CLASSES - 1);
+
+// Tamaño mínimo de cada chunk de la arena, y lo que se conserva al cerrar el
+// último scope (los chunks más grandes se devuelven al sistema)
+static const size_t SCRATCH_CHUNK_BYTES = 64 * 1024;
+static const size_t SCRATCH_KEEP_BYTES = 16 * 1024 * 1024;
+
+// Cabecera de cada reserva de scratch_allocator: origen y tamaño
+static const size_t SCRATCH_HEADER = 16;
+static const size_t SCRATCH_FROM_HEAP = 0;
+static const size_t SCRATCH_FROM_ARENA = 1;
+
+/**
+ * @brief Trozo de memoria de la arena; los datos van justo detrás
+ */
+struct scratchChunk
+{
+	scratchChunk* next;
+	size_t size;       // Bytes de datos
+	size_t used;       // Bytes ocupados (puntero de bump)
+	size_t pad;        // Mantiene los datos alineados a 16 bytes
+
+	char* data() { return((char*)(this + 1)); }
+};
+
+/**
+ * @brief Estado de memoria de un hilo (POD: se inicializa a cero)
+ * Los chunks forman una lista; los que van detrás de 'current' están libres
+ * y se reutilizan antes de pedir otro
+ */
+struct threadMemory
+{
+	scratchChunk* first;
+	scratchChunk* current;
+	size_t depth;          // Scopes abiertos
+	size_t suspended;      // > 0: reservas al heap aunque haya scope
+	bool dead;             // El hilo está terminando: todo va al heap
+	limb* blocks[BLOCK_CLASSES][BLOCKS_PER_CLASS];
+	size_t blockCount[BLOCK_CLASSES];
+};
+
+static BIGINT_TLS threadMemory localMemory;
+
+/**
+ * @brief Devuelve al sistema los chunks y los bloques guardados de un hilo
+ * Los chunks solo si no hay ningún scope abierto
+ */
+static void releaseMemory(threadMemory& mem)
+{
+	if(mem.depth == 0)
+	{
+		while(mem.first != NULL)
+		{
+			scratchChunk* next = mem.first->next;
+			::operator delete(mem.first);
+			mem.first = next;
+		}
+		mem.current = NULL;
+	}
+	for(size_t c = 0; c < BLOCK_CLASSES; c++)
+	{
+		while(mem.blockCount[c] > 0)
+			delete[] mem.blocks[c][--mem.blockCount[c]];
+	}
+}
+
+#if __cplusplus >= 201103L
+/**
+ * @brief Libera la memoria del hilo cuando termina (solo C++11)
+ * Marca el estado como muerto: los bigint que se destruyan después (los
+ * estáticos, por ejemplo) devuelven su memoria directamente al heap
+ */
+struct threadMemoryCleanup
+{
+	~threadMemoryCleanup()
+	{
+		releaseMemory(localMemory);
+		localMemory.dead = true;
+	}
+};
+
+static thread_local threadMemoryCleanup localCleanup;
+#endif
+
+/**
+ * @brief Acceso al estado de memoria del hilo actual
+ */
+static threadMemory& memory()
+{
+#if __cplusplus >= 201103L
+	(void)&localCleanup;  // Registra la limpieza al salir del hilo
+#endif
+	return(localMemory);
+}
+
+// ---------- Caché de bloques de limb_buffer ----------
+
+/**
+ * @brief Clase de tamaño de un bloque, o BLOCK_CLASSES si no se guarda
+ */
+static size_t blockClass(size_t cap)
+{
+	size_t c = 0;
+	size_t size = BLOCK_MIN_LIMBS;
+	while(size < cap && c < BLOCK_CLASSES)
+	{
+		size <<= 1;
+		c++;
+	}
+	return((size == cap) ? c : BLOCK_CLASSES);
+}
+
+/**
+ * @brief Reserva un bloque de limbs, reutilizando uno guardado si hay
+ * @param cap Capacidad pedida; se redondea a potencia de 2 si entra en la caché
+ * @return Bloque de al menos cap limbs
+ */
+static limb* allocBlock(size_t& cap)
+{
+	if(cap <= BLOCK_MAX_LIMBS)
+	{
+		size_t size = BLOCK_MIN_LIMBS;
+		while(size < cap)
+			size <<= 1;
+		cap = size;
+		threadMemory& mem = memory();
+		size_t c = blockClass(cap);
+		if(!mem.dead && mem.blockCount[c] > 0)
+			return(mem.blocks[c][--mem.blockCount[c]]);
+	}
+	return(new limb[cap]);
+}
+
+/**
+ * @brief Devuelve un bloque: a la caché del hilo si cabe, si no al heap
+ */
+static void freeBlock(limb* block, size_t cap)
+{
+	size_t c = blockClass(cap);
+	if(c < BLOCK_CLASSES)
+	{
+		threadMemory& mem = memory();
+		if(!mem.dead && mem.blockCount[c] < BLOCKS_PER_CLASS)
+		{
+			mem.blocks[c][mem.blockCount[c]++] = block;
+			return;
+		}
+	}
+	delete[] block;
+}
+
+// ---------- Arena de temporales ----------
+
+/**
+ * @brief Reserva de scratch_allocator
+ * Dentro de un scope sale de la arena (avanzar un puntero); fuera, del heap.
+ * Una cabecera guarda el origen para saber cómo liberarla
+ * @param bytes Bytes pedidos
+ * @return Puntero a los datos (alineado a 16 bytes)
+ */
+static void* scratchAllocate(size_t bytes)
+{
+	threadMemory& mem = memory();
+	size_t need = SCRATCH_HEADER + ((bytes + 15) & ~(size_t)15);
+	char* base;
+	size_t origin;
+	if(mem.depth == 0 || mem.suspended > 0 || mem.dead)
+	{
+		base = (char*)::operator new(need);
+		origin = SCRATCH_FROM_HEAP;
+	}
+	else
+	{
+		scratchChunk* c = mem.current;
+		if(c == NULL || c->size - c->used < need)
+		{
+			// Reutiliza el siguiente chunk libre si es lo bastante grande
+			scratchChunk* next = (c != NULL) ? c->next : mem.first;
+			if(next == NULL || next->size < need)
+			{
+				size_t size = std::max(need, SCRATCH_CHUNK_BYTES);
+				if(c != NULL)
+					size = std::max(size, 2 * c->size);
+				scratchChunk* chunk = (scratchChunk*)::operator new(sizeof(scratchChunk) + size);
+				chunk->size = size;
+				chunk->next = next;
+				if(c != NULL)
+					c->next = chunk;
+				else
+					mem.first = chunk;
+				next = chunk;
+			}
+			next->used = 0;
+			c = next;
+			mem.current = c;
+		}
+		base = c->data() + c->used;
+		c->used += need;
+		origin = SCRATCH_FROM_ARENA;
+	}
+	((size_t*)base)[0] = origin;
+	((size_t*)base)[1] = need;
+	return(base + SCRATCH_HEADER);
+}
+
+/**
+ * @brief Liberación de scratch_allocator
+ * Lo que vino del heap se libera; lo de la arena no cuesta nada, y si es lo
+ * último reservado en el chunk actual se recupera en el momento (los
+ * temporales de la recursión se liberan en orden de pila)
+ * @param p Puntero devuelto por scratchAllocate
+ */
+static void scratchDeallocate(void* p)
+{
+	char* base = (char*)p - SCRATCH_HEADER;
+	size_t origin = ((size_t*)base)[0];
+	size_t need = ((size_t*)base)[1];
+	if(origin == SCRATCH_FROM_HEAP)
+	{
+		::operator delete(base);
+		return;
+	}
+	threadMemory& mem = memory();
+	scratchChunk* c = mem.current;
+	if(c != NULL && base + need == c->data() + c->used)
+		c->used -= need;
+}
+
+/**
+ * @brief Abre un scope: lo reservado a partir de aquí se libera junto al cerrarlo
+ */
+bigint::scratch_scope::scratch_scope()
+{
+	threadMemory& mem = memory();
+	this->chunk = mem.current;
+	this->used = (mem.current != NULL) ? mem.current->used : 0;
+	mem.depth++;
+}
+
+/**
+ * @brief Cierra el scope: vuelve la arena al punto de apertura de una vez
+ * Al cerrar el último scope del hilo, los chunks por encima de
+ * SCRATCH_KEEP_BYTES se devuelven al sistema
+ */
+bigint::scratch_scope::~scratch_scope()
+{
+	threadMemory& mem = memory();
+	scratchChunk* c = (scratchChunk*)this->chunk;
+	mem.current = c;
+	if(c != NULL)
+		c->used = this->used;
+	else if(mem.first != NULL)
+		mem.first->used = 0;
+	mem.depth--;
+	if(mem.depth == 0)
+	{
+		mem.current = NULL;
+		scratchChunk** link = &mem.first;
+		while(*link != NULL)
+		{
+			scratchChunk* chunk = *link;
+			if(chunk->size > SCRATCH_KEEP_BYTES)
+			{
+				*link = chunk->next;
+				::operator delete(chunk);
+			}
+			else
+				link = &chunk->next;
+		}
+	}
+}
+
+/**
+ * @brief Libera la memoria guardada por el hilo actual
+ * Los chunks de la arena (si no hay scopes abiertos) y los bloques de la
+ * caché de limb_buffer
+ */
+void bigint::releaseThreadMemory()
+{
+	releaseMemory(memory());
+}
+
+/**
+ * @brief Mientras existe, scratch_allocator reserva en el heap aunque haya
+ * scope: para datos que deben sobrevivir a la operación (caché de potencias)
+ */
+class scratchSuspend
+{
+	public:
+		scratchSuspend() { memory().suspended++; }
+		~scratchSuspend() { memory().suspended--; }
+};
+
+/**
+ * @brief Allocator STL sobre scratchAllocate/scratchDeallocate
+ */
+template <class T>
+class scratch_allocator
+{
+	public:
+		typedef T value_type;
+		typedef T* pointer;
+		typedef const T* const_pointer;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+
+		template <class U>
+		struct rebind
+		{
+			typedef scratch_allocator<U> other;
+		};
+
+		scratch_allocator() {}
+		scratch_allocator(const scratch_allocator&) {}
+		template <class U>
+		scratch_allocator(const scratch_allocator<U>&) {}
+
+		pointer address(reference x) const { return(&x); }
+		const_pointer address(const_reference x) const { return(&x); }
+		size_type max_size() const { return((size_t)-1 / sizeof(T)); }
+
+		pointer allocate(size_type n, const void* = 0)
+		{
+			return((pointer)scratchAllocate(n * sizeof(T)));
+		}
+
+		void deallocate(pointer p, size_type)
+		{
+			scratchDeallocate(p);
+		}
+
+		void construct(pointer p, const T& value) { new((void*)p) T(value); }
+		void destroy(pointer p) { p->~T(); }
+
+		bool operator==(const scratch_allocator&) const { return(true); }
+		bool operator!=(const scratch_allocator&) const { return(false); }
+};
+
+// Vector de limbs para los temporales de los núcleos
+typedef std::vector<limb, scratch_allocator<limb> > limb_vector;
+
+// ==================== BUFFER DE LIMBS (SBO) ====================
+
+limb_buffer::limb_buffer() : ptr(inline_data), len(0), cap(INLINE_LIMBS)
+{
+}
+
+limb_buffer::limb_buffer(const limb_buffer& source) : ptr(inline_data), len(0), cap(INLINE_LIMBS)
+{
+	this->assign(source.begin(), source.end());
+}
+
+limb_buffer& limb_buffer::operator=(const limb_buffer& source)
+{
+	if(this != &source)
+		this->assign(source.begin(), source.end());
+	return(*this);
+}
+
+#ifdef BIGINT_HAS_MOVE
+/**
+ * @brief Constructor de movimiento: roba el bloque del heap si lo hay
+ * (los valores internos de hasta 128 bits simplemente se copian)
+ */
+limb_buffer::limb_buffer(limb_buffer&& source) noexcept : ptr(inline_data), len(0), cap(INLINE_LIMBS)
+{
+	this->swap(source);
+}
+
+limb_buffer& limb_buffer::operator=(limb_buffer&& source) noexcept
+{
+	if(this == &source)
+		return(*this);
+	this->swap(source);
+	source.clear();
+	return(*this);
+}
+#endif
+
+limb_buffer::~limb_buffer()
+{
+	if(!this->isInline())
+		freeBlock(this->ptr, this->cap);
+}
+
+/**
+ * @brief Pasa a un bloque del heap de al menos minCap limbs
+ * Duplica la capacidad para que push_back sea O(1) amortizado; los bloques
+ * salen de la caché del hilo siempre que se pueda
+ */
+void limb_buffer::grow(size_t minCap)
+{
+	if(minCap > MAX_LIMBS)
+		throw std::length_error("bigint: too many limbs");
+	size_t newCap = 2 * this->cap;
+	if(newCap < minCap)
+		newCap = minCap;
+	if(newCap > MAX_LIMBS)
+		newCap = MAX_LIMBS;
+	value_type* block = allocBlock(newCap);
+	for(size_t i = 0; i < this->len; i++)
+		block[i] = this->ptr[i];
+	if(!this->isInline())
+		freeBlock(this->ptr, this->cap);
+	this->ptr = block;
+	this->cap = newCap;
+}
+
+void limb_buffer::resize(size_t n, value_type v)
+{
+	this->reserve(n);
+	for(size_t i = this->len; i < n; i++)
+		this->ptr[i] = v;
+	this->len = n;
+}
+
+void limb_buffer::assign(const value_type* first, const value_type* last)
+{
+	size_t n = (size_t)(last - first);
+	if(n > this->cap)
+	{
+		this->len = 0;
+		this->grow(n);
+	}
+	for(size_t i = 0; i < n; i++)
+		this->ptr[i] = first[i];
+	this->len = n;
+}
+
+/**
+ * @brief Intercambia el contenido en O(1)
+ * Los bloques del heap cambian de dueño; los datos internos se copian
+ */
+void limb_buffer::swap(limb_buffer& other)
+{
+	if(this == &other)
+		return;
+	bool thisInline = this->isInline();
+	bool otherInline = other.isInline();
+	value_type* thisPtr = this->ptr;
+	size_t thisLen = this->len;
+	size_t thisCap = this->cap;
+
+	for(size_t i = 0; i < INLINE_LIMBS; i++)
+	{
+		value_type tmp = this->inline_data[i];
+		this->inline_data[i] = other.inline_data[i];
+		other.inline_data[i] = tmp;
+	}
+	this->ptr = otherInline ? this->inline_data : other.ptr;
+	this->len = other.len;
+	this->cap = other.cap;
+	other.ptr = thisInline ? other.inline_data : thisPtr;
+	other.len = thisLen;
+	other.cap = thisCap;
+}
+
+bool limb_buffer::operator==(const limb_buffer& other) const
+{
+	if(this->len != other.len)
+		return(false);
+	for(size_t i = 0; i < this->len; i++)
+	{
+		if(this->ptr[i] != other.ptr[i])
+			return(false);
+	}
+	return(true);
+}
+
 // ==================== CONSTRUCTORES ====================
 
 /**
  * @brief Constructor por defecto
- * Inicializa el bigint con valor "0"
+ * Inicializa el bigint con valor 0 (vector de limbs vacío)
  */
 bigint::bigint()
 {
-	this->str = "0";
 }
 
 /**
- * @brief Constructor con entero sin signo
- * Convierte el entero a string para almacenamiento
- * @param num Número entero a convertir
+ * @brief Constructor con entero sin signo
+ * Un unsigned int cabe siempre en un único limb
+ * @param num Número entero a convertir
+ */
+bigint::bigint(unsigned int num)
+{
+	if(num != 0)
+		this->limbs.push_back(num);
+}
+
+/**
+ * @brief Constructor de copia
+ * @param source Objeto bigint a copiar
+ */
+bigint::bigint(const bigint& source)
+{
+	(*this) = source;
+}
+
+#ifdef BIGINT_HAS_MOVE
+/**
+ * @brief Constructor de movimiento
+ * Se queda con el buffer de source, que pasa a valer 0
+ * @param source Objeto bigint temporal
+ */
+bigint::bigint(bigint&& source) noexcept
+{
+	this->limbs.swap(source.limbs);
+}
+#endif
+
+// ==================== OPERADORES DE ASIGNACIÓN ====================
+
+/**
+ * @brief Operador de asignación
+ * @param source Objeto bigint a asignar
+ * @return Referencia al objeto actual
+ */
+bigint& bigint::operator=(const bigint& source)
+{
+	if(this == &source)
+		return(*this);
+	this->limbs = source.limbs;
+	return(*this);
+}
+
+#ifdef BIGINT_HAS_MOVE
+/**
+ * @brief Operador de asignación por movimiento
+ * @param source Objeto bigint temporal (queda a 0)
+ * @return Referencia al objeto actual
+ */
+bigint& bigint::operator=(bigint&& source) noexcept
+{
+	if(this == &source)
+		return(*this);
+	this->limbs.swap(source.limbs);
+	source.limbs.clear();
+	return(*this);
+}
+#endif
+
+// ==================== FUNCIONES AUXILIARES ====================
+
+/**
+ * @brief Elimina los limbs a cero de la parte más significativa
+ */
+void bigint::trim()
+{
+	while(!this->limbs.empty() && this->limbs.back() == 0)
+		this->limbs.pop_back();
+}
+
+/**
+ * @brief Multiplica in-place un vector de limbs por un valor de un limb
+ * @param limbs Vector de limbs (little-endian): std::vector o limb_buffer
+ * @param m Multiplicador
+ */
+template<class Buffer>
+static void mulSmall(Buffer& limbs, limb m)
+{
+	uint64_t carry = 0;
+	for(size_t i = 0; i < limbs.size(); i++)
+	{
+		uint64_t cur = (uint64_t)limbs[i] * m + carry;
+		limbs[i] = (limb)cur;
+		carry = cur >> 32;
+	}
+	if(carry != 0)
+		limbs.push_back((limb)carry);
+}
+
+/**
+ * @brief Divide in-place un vector de limbs por un valor de un limb
+ * @param limbs Vector de limbs (little-endian): std::vector o limb_buffer;
+ * queda normalizado
+ * @param d Divisor (distinto de 0)
+ * @return Resto de la división
+ */
+template<class Buffer>
+static limb divSmall(Buffer& limbs, limb d)
+{
+	uint64_t rem = 0;
+	for(size_t i = limbs.size(); i > 0; i--)
+	{
+		uint64_t cur = (rem << 32) | limbs[i - 1];
+		limbs[i - 1] = (limb)(cur / d);
+		rem = cur % d;
+	}
+	while(!limbs.empty() && limbs.back() == 0)
+		limbs.pop_back();
+	return((limb)rem);
+}
+
+/**
+ * @brief Copia un vector de trabajo en el buffer de un bigint
+ */
+static void storeLimbs(limb_buffer& dst, const limb_vector& src)
+{
+	if(src.empty())
+		dst.clear();
+	else
+		dst.assign(&src[0], &src[0] + src.size());
+}
+
+/**
+ * @brief Valor de un buffer de como mucho 2 limbs como entero de 64 bits
+ */
+static uint64_t toU64(const limb_buffer& b)
+{
+	uint64_t v = 0;
+	if(b.size() > 0)
+		v = b[0];
+	if(b.size() > 1)
+		v |= (uint64_t)b[1] << 32;
+	return(v);
+}
+
+/**
+ * @brief Guarda un entero de 64 bits en un buffer (normalizado, sin heap)
+ */
+static void storeU64(limb_buffer& b, uint64_t v)
+{
+	b.clear();
+	if(v != 0)
+		b.push_back((limb)v);
+	if((v >> 32) != 0)
+		b.push_back((limb)(v >> 32));
+}
+
+/**
+ * @brief Potencia de 10 que cabe en un limb
+ * @param n Exponente (0 <= n <= 9)
+ * @return 10^n
+ */
+static limb smallPow10(unsigned int n)
+{
+	limb res = 1;
+	while(n-- > 0)
+		res *= 10;
+	return(res);
+}
+
+// ==================== NÚCLEOS DE SUMA ====================
+
+// Activado por defecto; solo tiene efecto si la CPU soporta AVX2
+bool bigint::simd_enabled = true;
+
+// Por debajo de este tamaño el bucle escalar gana (o empata)
+static const size_t SIMD_MIN_LIMBS = 16;
+
+/**
+ * @brief Suma escalar de dos arrays de limbs de la misma longitud: r = a + b
+ * Recorre del limb menos significativo al más significativo; r puede
+ * coincidir con a y/o b (suma in-place)
+ * @param r Destino (n limbs)
+ * @param a Primer operando (n limbs)
+ * @param b Segundo operando (n limbs)
+ * @param n Número de limbs
+ * @return Carry final (0 o 1)
+ */
+static limb addNScalar(limb* r, const limb* a,
+	const limb* b, size_t n)
+{
+	uint64_t carry = 0;
+	for(size_t i = 0; i < n; i++)
+	{
+		uint64_t res = (uint64_t)a[i] + b[i] + carry;
+		r[i] = (limb)res;
+		carry = res >> 32;
+	}
+	return((limb)carry);
+}
+
+#ifdef BIGINT_HAS_AVX2_KERNEL
+/**
+ * @brief Suma AVX2 con carry-lookahead, 8 limbs por bloque
+ * Cada bloque suma sus 8 limbs sin carry y saca dos máscaras de 8 bits:
+ * G (el limb generó carry, s < a) y P (lo propaga si le llega, s == ~0).
+ * Los carries de entrada de los 8 limbs salen de una sola suma entera,
+ * S = 2G + P + cin: C = (S ^ P) & 0xFF, y el carry al siguiente bloque es
+ * S >> 8. Después se suma C a los limbs en vector, sin ramas por limb
+ * @param r Destino (n limbs, puede coincidir con a y/o b)
+ * @param a Primer operando (n limbs)
+ * @param b Segundo operando (n limbs)
+ * @param n Número de limbs
+ * @return Carry final (0 o 1)
+ */
+__attribute__((target("avx2")))
+static limb addNAvx2(limb* r, const limb* a,
+	const limb* b, size_t n)
+{
+	const __m256i sign = _mm256_set1_epi32((int)0x80000000u);
+	const __m256i ones = _mm256_set1_epi32(-1);
+	const __m256i lanes = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+	unsigned int carry = 0;
+	size_t i = 0;
+	for(; i + 8 <= n; i += 8)
+	{
+		__m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+		__m256i vb = _mm256_loadu_si256((const __m256i*)(b + i));
+		__m256i sum = _mm256_add_epi32(va, vb);
+		// Comparación sin signo s < a: se invierte el bit de signo de ambos
+		__m256i gen = _mm256_cmpgt_epi32(_mm256_xor_si256(va, sign),
+			_mm256_xor_si256(sum, sign));
+		__m256i prop = _mm256_cmpeq_epi32(sum, ones);
+		unsigned int g = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(gen));
+		unsigned int p = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(prop));
+		unsigned int lookahead = 2 * g + p + carry;
+		unsigned int carries = (lookahead ^ p) & 0xFF;
+		carry = lookahead >> 8;
+		// Máscara -> lanes a -1 donde entra carry; restar -1 suma 1
+		__m256i cin = _mm256_cmpeq_epi32(
+			_mm256_and_si256(_mm256_set1_epi32((int)carries), lanes), lanes);
+		_mm256_storeu_si256((__m256i*)(r + i), _mm256_sub_epi32(sum, cin));
+	}
+	uint64_t tail = carry;
+	for(; i < n; i++)
+	{
+		uint64_t res = (uint64_t)a[i] + b[i] + tail;
+		r[i] = (limb)res;
+		tail = res >> 32;
+	}
+	return((limb)tail);
+}
+
+/**
+ * @brief Consulta a la CPU si soporta AVX2
+ * @return true si la CPU soporta AVX2
+ */
+static bool detectAvx2()
+{
+	__builtin_cpu_init();
+	return(__builtin_cpu_supports("avx2") != 0);
+}
+
+// Se detecta una sola vez al cargar el programa (antes de que haya hilos);
+// hasta entonces vale false y se usa el bucle escalar
+static const bool CPU_HAS_AVX2 = detectAvx2();
+
+/**
+ * @brief Indica si la CPU soporta AVX2 (detectado al arrancar)
+ */
+static bool cpuHasAvx2()
+{
+	return(CPU_HAS_AVX2);
+}
+#endif
+
+/**
+ * @brief Indica si addN usará el núcleo AVX2
+ * @return true si está compilado, la CPU lo soporta y simd_enabled es true
+ */
+bool bigint::simdAvailable()
+{
+#ifdef BIGINT_HAS_AVX2_KERNEL
+	return(bigint::simd_enabled && cpuHasAvx2());
+#else
+	return(false);
+#endif
+}
+
+/**
+ * @brief Suma dos arrays de limbs de la misma longitud: r = a + b
+ * Elige en tiempo de ejecución entre el núcleo AVX2 y el escalar; r puede
+ * coincidir con a y/o b (suma in-place)
+ * @param r Destino (n limbs)
+ * @param a Primer operando (n limbs)
+ * @param b Segundo operando (n limbs)
+ * @param n Número de limbs
+ * @return Carry final (0 o 1)
+ */
+static limb addN(limb* r, const limb* a,
+	const limb* b, size_t n)
+{
+#ifdef BIGINT_HAS_AVX2_KERNEL
+	if(n >= SIMD_MIN_LIMBS && bigint::simd_enabled && cpuHasAvx2())
+		return(addNAvx2(r, a, b, n));
+#endif
+	return(addNScalar(r, a, b, n));
+}
+
+/**
+ * @brief Propaga un carry in-place sobre un array de limbs
+ * Se detiene en cuanto el carry se absorbe, así que normalmente solo
+ * toca uno o dos limbs
+ * @param r Array de limbs
+ * @param n Número de limbs
+ * @param carry Carry entrante
+ * @return Carry que sale por la parte más significativa
+ */
+static limb propagateCarry(limb* r, size_t n, limb carry)
+{
+	for(size_t i = 0; i < n && carry != 0; i++)
+	{
+		r[i] += carry;
+		carry = (r[i] < carry) ? 1 : 0;
+	}
+	return(carry);
+}
+
+/**
+ * @brief Suma por columnas de varios arrays de limbs: r = sum(terms)
+ * Trabaja en bloques de columnas que caben en L1: cada sumando se acumula
+ * fila a fila en un bloque de uint64 (bucle vectorizable, sin carries) y
+ * después se propaga el carry del bloque una sola vez. Los operandos deben
+ * venir ordenados por longitud decreciente. El acumulador de 64 bits admite
+ * hasta 2^32 sumandos sin desbordar
+ * @param r Destino (sizes[0] limbs)
+ * @param terms Arrays de limbs de cada sumando
+ * @param sizes Longitud de cada sumando (decreciente)
+ * @param count Número de sumandos
+ * @return Carry que sale por encima de sizes[0] (puede ocupar dos limbs)
+ */
+static uint64_t addColumns(limb* r, const limb* const* terms,
+	const size_t* sizes, size_t count)
+{
+	const size_t BLOCK = 512;
+	uint64_t acc[BLOCK];
+	uint64_t carry = 0;
+	size_t active = count;
+	for(size_t start = 0; start < sizes[0]; start += BLOCK)
+	{
+		size_t len = std::min(BLOCK, sizes[0] - start);
+		while(sizes[active - 1] <= start)
+			active--;
+		for(size_t j = 0; j < len; j++)
+			acc[j] = 0;
+		for(size_t t = 0; t < active; t++)
+		{
+			const limb* src = terms[t] + start;
+			size_t n = std::min(len, sizes[t] - start);
+			for(size_t j = 0; j < n; j++)
+				acc[j] += src[j];
+		}
+		for(size_t j = 0; j < len; j++)
+		{
+			carry += acc[j];
+			r[start + j] = (limb)carry;
+			carry >>= 32;
+		}
+	}
+	return(carry);
+}
+
+// ==================== NÚCLEOS DE RESTA ====================
+
+/**
+ * @brief Resta escalar de dos arrays de limbs de la misma longitud: r = a - b
+ * r puede coincidir con a y/o b (resta in-place)
+ * @param r Destino (n limbs)
+ * @param a Minuendo (n limbs)
+ * @param b Sustraendo (n limbs)
+ * @param n Número de limbs
+ * @return Borrow final (0 o 1)
+ */
+static limb subNScalar(limb* r, const limb* a, const limb* b, size_t n)
+{
+	limb borrow = 0;
+	for(size_t i = 0; i < n; i++)
+	{
+		uint64_t res = (uint64_t)a[i] - b[i] - borrow;
+		r[i] = (limb)res;
+		borrow = (limb)(res >> 63);
+	}
+	return(borrow);
+}
+
+#ifdef BIGINT_HAS_AVX2_KERNEL
+/**
+ * @brief Resta AVX2 con borrow-lookahead, 8 limbs por bloque
+ * Igual que addNAvx2 con G = (a < b) (el limb genera borrow) y
+ * P = (a == b) (la diferencia es 0 y propaga el borrow que le llegue)
+ * @param r Destino (n limbs, puede coincidir con a y/o b)
+ * @param a Minuendo (n limbs)
+ * @param b Sustraendo (n limbs)
+ * @param n Número de limbs
+ * @return Borrow final (0 o 1)
+ */
+__attribute__((target("avx2")))
+static limb subNAvx2(limb* r, const limb* a, const limb* b, size_t n)
+{
+	const __m256i sign = _mm256_set1_epi32((int)0x80000000u);
+	const __m256i lanes = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+	unsigned int borrow = 0;
+	size_t i = 0;
+	for(; i + 8 <= n; i += 8)
+	{
+		__m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+		__m256i vb = _mm256_loadu_si256((const __m256i*)(b + i));
+		__m256i diff = _mm256_sub_epi32(va, vb);
+		__m256i gen = _mm256_cmpgt_epi32(_mm256_xor_si256(vb, sign),
+			_mm256_xor_si256(va, sign));
+		__m256i prop = _mm256_cmpeq_epi32(va, vb);
+		unsigned int g = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(gen));
+		unsigned int p = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(prop));
+		unsigned int lookahead = 2 * g + p + borrow;
+		unsigned int borrows = (lookahead ^ p) & 0xFF;
+		borrow = lookahead >> 8;
+		// Máscara -> lanes a -1 donde entra borrow; sumar -1 resta 1
+		__m256i bin = _mm256_cmpeq_epi32(
+			_mm256_and_si256(_mm256_set1_epi32((int)borrows), lanes), lanes);
+		_mm256_storeu_si256((__m256i*)(r + i), _mm256_add_epi32(diff, bin));
+	}
+	for(; i < n; i++)
+	{
+		uint64_t res = (uint64_t)a[i] - b[i] - borrow;
+		r[i] = (limb)res;
+		borrow = (unsigned int)(res >> 63);
+	}
+	return((limb)borrow);
+}
+#endif
+
+/**
+ * @brief Resta dos arrays de limbs de la misma longitud: r = a - b
+ * Elige en tiempo de ejecución entre el núcleo AVX2 y el escalar; r puede
+ * coincidir con a y/o b (resta in-place)
+ * @param r Destino (n limbs)
+ * @param a Minuendo (n limbs)
+ * @param b Sustraendo (n limbs)
+ * @param n Número de limbs
+ * @return Borrow final (0 o 1)
+ */
+static limb subN(limb* r, const limb* a, const limb* b, size_t n)
+{
+#ifdef BIGINT_HAS_AVX2_KERNEL
+	if(n >= SIMD_MIN_LIMBS && bigint::simd_enabled && cpuHasAvx2())
+		return(subNAvx2(r, a, b, n));
+#endif
+	return(subNScalar(r, a, b, n));
+}
+
+/**
+ * @brief Propaga un borrow in-place sobre un array de limbs
+ * @param r Array de limbs
+ * @param n Número de limbs
+ * @param borrow Borrow entrante
+ * @return Borrow que sale por la parte más significativa
+ */
+static limb propagateBorrow(limb* r, size_t n, limb borrow)
+{
+	for(size_t i = 0; i < n && borrow != 0; i++)
+	{
+		limb old = r[i];
+		r[i] = old - borrow;
+		borrow = (old < borrow) ? 1 : 0;
+	}
+	return(borrow);
+}
+
+/**
+ * @brief Suma in-place r += b, con r de rn limbs y b de bn limbs (rn >= bn)
+ * @return Carry que sale por la parte más significativa de r
+ */
+static limb addInto(limb* r, size_t rn, const limb* b, size_t bn)
+{
+	limb carry = addN(r, r, b, bn);
+	return(propagateCarry(r + bn, rn - bn, carry));
+}
+
+/**
+ * @brief Resta in-place r -= b, con r de rn limbs y b de bn limbs (rn >= bn)
+ * @return Borrow que sale por la parte más significativa de r
+ */
+static limb subFrom(limb* r, size_t rn, const limb* b, size_t bn)
+{
+	limb borrow = subN(r, r, b, bn);
+	return(propagateBorrow(r + bn, rn - bn, borrow));
+}
+
+/**
+ * @brief Longitud de un array de limbs sin contar los ceros de cabecera
+ */
+static size_t normSize(const limb* a, size_t n)
+{
+	while(n > 0 && a[n - 1] == 0)
+		n--;
+	return(n);
+}
+
+/**
+ * @brief Compara dos arrays de limbs normalizados
+ * @return -1, 0 o 1 según a sea menor, igual o mayor que b
+ */
+static int cmpLimbs(const limb* a, size_t an, const limb* b, size_t bn)
+{
+	if(an != bn)
+		return((an < bn) ? -1 : 1);
+	for(size_t i = an; i > 0; i--)
+	{
+		if(a[i - 1] != b[i - 1])
+			return((a[i - 1] < b[i - 1]) ? -1 : 1);
+	}
+	return(0);
+}
+
+// ==================== REPARTO EN PARALELO ====================
+
+// Tamaño (en limbs del operando más corto) a partir del cual un producto
+// reparte sus subproductos entre los hilos del pool
+size_t bigint::parallel_threshold = 1024;
+
+typedef void (*parallelTask)(void*);
+
+#ifdef BIGINT_HAS_THREADS
+// Pool compartido por todo el proceso. Se crea en el primer producto que lo
+// necesita; poolReady publica poolInstance (NULL si solo hay un hilo)
+static std::mutex poolLock;
+static std::atomic<bool> poolReady(false);
+static work_stealing_pool* poolInstance = NULL;
+static size_t requestedThreads = 0;  // 0: uno por núcleo
+
+/**
+ * @brief Para y libera el pool al terminar el programa
+ */
+struct poolShutdown
+{
+	~poolShutdown()
+	{
+		delete poolInstance;
+		poolInstance = NULL;
+	}
+};
+
+static poolShutdown poolCleanup;
+
+/**
+ * @brief Número de hilos efectivo para una petición (0: uno por núcleo)
+ */
+static size_t resolveThreads(size_t requested)
+{
+	if(requested == 0)
+		requested = std::thread::hardware_concurrency();
+	return((requested == 0) ? 1 : requested);
+}
+
+/**
+ * @brief Pool de hilos, creado la primera vez
+ * @return El pool, o NULL si se trabaja con un solo hilo
+ */
+static work_stealing_pool* parallelPool()
+{
+	if(!poolReady.load(std::memory_order_acquire))
+	{
+		std::lock_guard<std::mutex> guard(poolLock);
+		if(!poolReady.load(std::memory_order_relaxed))
+		{
+			// El hilo que espera también trabaja: un worker menos
+			size_t count = resolveThreads(requestedThreads);
+			if(count > 1)
+				poolInstance = new work_stealing_pool(count - 1);
+			poolReady.store(true, std::memory_order_release);
+		}
+	}
+	return(poolInstance);
+}
+#endif
+
+/**
+ * @brief Configura el número de hilos de la multiplicación en paralelo
+ * El pool actual se para y se crea otro en el siguiente producto grande.
+ * No debe llamarse mientras otro hilo está operando con bigint
+ * @param count Hilos en total, contando el que llama (0: uno por núcleo,
+ * 1: sin paralelismo). Sin C++11 no tiene efecto
+ */
+void bigint::setThreadCount(size_t count)
+{
+#ifdef BIGINT_HAS_THREADS
+	std::lock_guard<std::mutex> guard(poolLock);
+	delete poolInstance;
+	poolInstance = NULL;
+	requestedThreads = count;
+	poolReady.store(false, std::memory_order_release);
+#else
+	(void)count;
+#endif
+}
+
+/**
+ * @brief Número de hilos que usa la multiplicación en paralelo
+ * @return Hilos en total (1 sin C++11)
+ */
+size_t bigint::getThreadCount()
+{
+#ifdef BIGINT_HAS_THREADS
+	std::lock_guard<std::mutex> guard(poolLock);
+	return(resolveThreads(requestedThreads));
+#else
+	return(1);
+#endif
+}
+
+/**
+ * @brief Ejecuta fn(args[i]) para cada i y espera a que terminen todas
+ * Si el tamaño llega a parallel_threshold y hay pool, las tareas se
+ * reparten entre los hilos; si no, se ejecutan en orden en este hilo.
+ * Cada tarea abre su propio scratch_scope y solo escribe en memoria que
+ * ya ha reservado quien llama, así que el resultado no depende del reparto
+ * @param fn Tarea
+ * @param args Argumento de cada tarea
+ * @param count Número de tareas
+ * @param size Tamaño del problema (limbs del operando más corto)
+ */
+static void forkJoin(parallelTask fn, void* const* args, size_t count, size_t size)
+{
+#ifdef BIGINT_HAS_THREADS
+	work_stealing_pool* pool = (size >= bigint::parallel_threshold) ? parallelPool() : NULL;
+	if(pool != NULL)
+	{
+		work_stealing_pool::task_group group;
+		for(size_t i = 0; i < count; i++)
+			pool->submit(group, fn, args[i]);
+		pool->wait(group);
+		return;
+	}
+#else
+	(void)size;
+#endif
+	for(size_t i = 0; i < count; i++)
+		fn(args[i]);
+}
+
+// ==================== NÚCLEOS DE MULTIPLICACIÓN ====================
+
+// Umbrales (en limbs del operando más corto) medidos con ./bench --crossover:
+// productos equilibrados en x86-64, g++ -O2, un hilo (tabla en el README)
+size_t bigint::karatsuba_threshold = 40;
+size_t bigint::toom3_threshold = 750;
+size_t bigint::ntt_threshold = 8000;
+
+/**
+ * @brief Multiplica y acumula: r += a * m
+ * @param r Destino (n limbs)
+ * @param a Operando (n limbs)
+ * @param n Número de limbs
+ * @param m Multiplicador de un limb
+ * @return Limb que sale por la parte más significativa
+ */
+static limb addMul1(limb* r, const limb* a, size_t n, limb m)
+{
+	uint64_t carry = 0;
+	for(size_t i = 0; i < n; i++)
+	{
+		// (2^32-1)^2 + 2 * (2^32-1) == 2^64-1: nunca desborda
+		uint64_t cur = (uint64_t)a[i] * m + r[i] + carry;
+		r[i] = (limb)cur;
+		carry = cur >> 32;
+	}
+	return((limb)carry);
+}
+
+/**
+ * @brief Multiplicación escolar O(an * bn)
+ * @param r Destino (an + bn limbs, no puede solaparse con a ni b)
+ */
+static void mulSchoolbook(limb* r, const limb* a, size_t an, const limb* b, size_t bn)
+{
+	for(size_t i = 0; i < an + bn; i++)
+		r[i] = 0;
+	for(size_t j = 0; j < bn; j++)
+		r[j + an] = addMul1(r + j, a, an, b[j]);
+}
+
+static void mulLimbs(limb* r, const limb* a, size_t an, const limb* b, size_t bn);
+
+/**
+ * @brief Multiplica dos arrays de limbs cualesquiera
+ * Admite ceros de cabecera y operandos en cualquier orden; escribe siempre
+ * los an + bn limbs de r
+ * @param r Destino (an + bn limbs, no puede solaparse con a ni b)
+ */
+static void mulAny(limb* r, const limb* a, size_t an, const limb* b, size_t bn)
+{
+	size_t total = an + bn;
+	an = normSize(a, an);
+	bn = normSize(b, bn);
+	if(an == 0 || bn == 0)
+	{
+		for(size_t i = 0; i < total; i++)
+			r[i] = 0;
+		return;
+	}
+	if(an >= bn)
+		mulLimbs(r, a, an, b, bn);
+	else
+		mulLimbs(r, b, bn, a, an);
+	for(size_t i = an + bn; i < total; i++)
+		r[i] = 0;
+}
+
+/**
+ * @brief Un subproducto r = a * b para forkJoin
+ */
+struct mulTask
+{
+	limb* r;         // Destino (an + bn limbs, reservado por quien reparte)
+	const limb* a;
+	size_t an;
+	const limb* b;
+	size_t bn;
+};
+
+static void runMulTask(void* arg)
+{
+	const mulTask& t = *(const mulTask*)arg;
+	bigint::scratch_scope scope;
+	mulAny(t.r, t.a, t.an, t.b, t.bn);
+}
+
+static mulTask makeMulTask(limb* r, const limb* a, size_t an, const limb* b, size_t bn)
+{
+	mulTask t;
+	t.r = r;
+	t.a = a;
+	t.an = an;
+	t.b = b;
+	t.bn = bn;
+	return(t);
+}
+
+/**
+ * @brief Producto muy desequilibrado (an > 2 * bn)
+ * Trocea a en bloques de bn limbs para que cada producto parcial sea
+ * equilibrado y pueda usar Karatsuba/Toom-3
+ */
+static void mulUnbalanced(limb* r, const limb* a, size_t an, const limb* b, size_t bn)
+{
+	limb_vector tmp(2 * bn);
+	for(size_t i = 0; i < an + bn; i++)
+		r[i] = 0;
+	for(size_t off = 0; off < an; off += bn)
+	{
+		size_t len = (an - off < bn) ? an - off : bn;
+		mulAny(&tmp[0], a + off, len, b, bn);
+		addInto(r + off, an + bn - off, &tmp[0], len + bn);
+	}
+}
+
+/**
+ * @brief Multiplicación de Karatsuba O(n^1.585)
+ * Con a = a1*B^h + a0 y b = b1*B^h + b0:
+ * a*b = z2*B^2h + ((a0+a1)(b0+b1) - z0 - z2)*B^h + z0
+ * Los tres productos son independientes y van juntos a forkJoin
+ * Requiere h < bn <= an, con h = ceil(an / 2)
+ */
+static void mulKaratsuba(limb* r, const limb* a, size_t an, const limb* b, size_t bn)
+{
+	size_t h = (an + 1) / 2;
+	size_t total = an + bn;
+
+	// sa = a0 + a1, sb = b0 + b1 (h + 1 limbs cada uno)
+	limb_vector sa(a, a + h);
+	limb_vector sb(b, b + h);
+	sa.push_back(addInto(&sa[0], h, a + h, an - h));
+	sb.push_back(addInto(&sb[0], h, b + h, bn - h));
+
+	// z0 = a0*b0 en r[0, 2h), z2 = a1*b1 en r[2h, an+bn) y sa*sb en z1
+	limb_vector z1(2 * h + 2);
+	mulTask tasks[3] = {
+		makeMulTask(r, a, h, b, h),
+		makeMulTask(r + 2 * h, a + h, an - h, b + h, bn - h),
+		makeMulTask(&z1[0], &sa[0], h + 1, &sb[0], h + 1)
+	};
+	void* args[3] = { &tasks[0], &tasks[1], &tasks[2] };
+	forkJoin(runMulTask, args, 3, bn);
+
+	// z1 = sa*sb - z0 - z2
+	subFrom(&z1[0], z1.size(), r, 2 * h);
+	subFrom(&z1[0], z1.size(), r + 2 * h, total - 2 * h);
+
+	addInto(r + h, total - h, &z1[0], normSize(&z1[0], z1.size()));
+}
+
+/**
+ * @brief Entero con signo (signo-magnitud) para los valores intermedios
+ * de Toom-3, que pueden ser negativos al evaluar en -1 y -2
+ */
+struct signedLimbs
+{
+	limb_vector mag;        // Magnitud normalizada
+	bool neg;               // true si es negativo (nunca para el 0)
+};
+
+static signedLimbs toSigned(const limb* a, size_t n)
+{
+	signedLimbs res;
+	res.mag.assign(a, a + normSize(a, n));
+	res.neg = false;
+	return(res);
+}
+
+/**
+ * @brief Suma con signo a + b (se usa también para la resta negando b)
+ */
+static signedLimbs signedAdd(const signedLimbs& a, const signedLimbs& b)
+{
+	signedLimbs res;
+	if(a.neg == b.neg)
+	{
+		const limb_vector& big = (a.mag.size() >= b.mag.size()) ? a.mag : b.mag;
+		const limb_vector& small = (a.mag.size() >= b.mag.size()) ? b.mag : a.mag;
+		res.mag = big;
+		res.mag.push_back(0);
+		if(!small.empty())
+			addInto(&res.mag[0], res.mag.size(), &small[0], small.size());
+		res.mag.resize(normSize(&res.mag[0], res.mag.size()));
+		res.neg = a.neg;
+		return(res);
+	}
+	int cmp = cmpLimbs(a.mag.empty() ? NULL : &a.mag[0], a.mag.size(),
+		b.mag.empty() ? NULL : &b.mag[0], b.mag.size());
+	const signedLimbs& big = (cmp >= 0) ? a : b;
+	const signedLimbs& small = (cmp >= 0) ? b : a;
+	res.mag = big.mag;
+	if(!small.mag.empty())
+		subFrom(&res.mag[0], res.mag.size(), &small.mag[0], small.mag.size());
+	res.mag.resize(res.mag.empty() ? 0 : normSize(&res.mag[0], res.mag.size()));
+	res.neg = !res.mag.empty() && big.neg;
+	return(res);
+}
+
+static signedLimbs signedSub(const signedLimbs& a, const signedLimbs& b)
+{
+	signedLimbs negB = b;
+	negB.neg = !b.neg && !b.mag.empty();
+	return(signedAdd(a, negB));
+}
+
+/**
+ * @brief Prepara res = a * b: reserva el destino y describe el producto
+ * La tarea no hace nada si algún factor es 0; signedMulFinish normaliza
+ */
+static mulTask signedMulPrepare(signedLimbs& res, const signedLimbs& a, const signedLimbs& b)
+{
+	res.neg = (a.neg != b.neg);
+	if(a.mag.empty() || b.mag.empty())
+	{
+		res.mag.clear();
+		return(makeMulTask(NULL, NULL, 0, NULL, 0));
+	}
+	res.mag.resize(a.mag.size() + b.mag.size());
+	return(makeMulTask(&res.mag[0], &a.mag[0], a.mag.size(), &b.mag[0], b.mag.size()));
+}
+
+static void signedMulFinish(signedLimbs& res)
+{
+	res.mag.resize(res.mag.empty() ? 0 : normSize(&res.mag[0], res.mag.size()));
+	res.neg = res.neg && !res.mag.empty();
+}
+
+static signedLimbs signedMul(const signedLimbs& a, const signedLimbs& b)
+{
+	signedLimbs res;
+	mulTask task = signedMulPrepare(res, a, b);
+	runMulTask(&task);
+	signedMulFinish(res);
+	return(res);
+}
+
+/**
+ * @brief Divide un valor con signo por un divisor pequeño (división exacta)
+ */
+static void signedDivExact(signedLimbs& a, limb d)
+{
+	uint64_t rem = 0;
+	for(size_t i = a.mag.size(); i > 0; i--)
+	{
+		uint64_t cur = (rem << 32) | a.mag[i - 1];
+		a.mag[i - 1] = (limb)(cur / d);
+		rem = cur % d;
+	}
+	a.mag.resize(a.mag.empty() ? 0 : normSize(&a.mag[0], a.mag.size()));
+	if(a.mag.empty())
+		a.neg = false;
+}
+
+/**
+ * @brief Multiplica un valor con signo por 2
+ */
+static void signedMul2(signedLimbs& a)
+{
+	limb carry = 0;
+	for(size_t i = 0; i < a.mag.size(); i++)
+	{
+		limb top = a.mag[i] >> 31;
+		a.mag[i] = (a.mag[i] << 1) | carry;
+		carry = top;
+	}
+	if(carry != 0)
+		a.mag.push_back(carry);
+}
+
+/**
+ * @brief Suma un valor no negativo desplazado: r += v * B^off
+ */
+static void addShifted(limb* r, size_t rn, const signedLimbs& v, size_t off)
+{
+	if(!v.mag.empty())
+		addInto(r + off, rn - off, &v.mag[0], v.mag.size());
+}
+
+/**
+ * @brief Multiplicación Toom-Cook 3 O(n^1.465)
+ * Divide cada operando en 3 trozos de k limbs, evalúa en 0, 1, -1, -2 e
+ * infinito, hace 5 productos recursivos e interpola (secuencia de Bodrato)
+ * Requiere 2k < bn <= an, con k = ceil(an / 3)
+ */
+static void mulToom3(limb* r, const limb* a, size_t an, const limb* b, size_t bn)
+{
+	size_t k = (an + 2) / 3;
+	size_t total = an + bn;
+
+	signedLimbs a0 = toSigned(a, k), a1 = toSigned(a + k, k), a2 = toSigned(a + 2 * k, an - 2 * k);
+	signedLimbs b0 = toSigned(b, k), b1 = toSigned(b + k, k), b2 = toSigned(b + 2 * k, bn - 2 * k);
+
+	// Evaluación: p(1), p(-1), p(-2)
+	signedLimbs pa = signedAdd(a0, a2), pb = signedAdd(b0, b2);
+	signedLimbs pa1 = signedAdd(pa, a1), pb1 = signedAdd(pb, b1);
+	signedLimbs pam1 = signedSub(pa, a1), pbm1 = signedSub(pb, b1);
+	signedLimbs pam2 = signedAdd(pam1, a2), pbm2 = signedAdd(pbm1, b2);
+	signedMul2(pam2);
+	signedMul2(pbm2);
+	pam2 = signedSub(pam2, a0);
+	pbm2 = signedSub(pbm2, b0);
+
+	// Productos puntuales (independientes: van juntos a forkJoin)
+	signedLimbs r0, r1, rm1, rm2, r4;
+	mulTask tasks[5] = {
+		signedMulPrepare(r0, a0, b0),
+		signedMulPrepare(r1, pa1, pb1),
+		signedMulPrepare(rm1, pam1, pbm1),
+		signedMulPrepare(rm2, pam2, pbm2),
+		signedMulPrepare(r4, a2, b2)
+	};
+	void* args[5] = { &tasks[0], &tasks[1], &tasks[2], &tasks[3], &tasks[4] };
+	forkJoin(runMulTask, args, 5, bn);
+	signedMulFinish(r0);
+	signedMulFinish(r1);
+	signedMulFinish(rm1);
+	signedMulFinish(rm2);
+	signedMulFinish(r4);
+
+	// Interpolación
+	signedLimbs r3 = signedSub(rm2, r1);
+	signedDivExact(r3, 3);
+	r1 = signedSub(r1, rm1);
+	signedDivExact(r1, 2);
+	signedLimbs r2 = signedSub(rm1, r0);
+	r3 = signedSub(r2, r3);
+	signedDivExact(r3, 2);
+	signedLimbs r4x2 = r4;
+	signedMul2(r4x2);
+	r3 = signedAdd(r3, r4x2);
+	r2 = signedAdd(r2, r1);
+	r2 = signedSub(r2, r4);
+	r1 = signedSub(r1, r3);
+
+	// Recomposición: r = r0 + r1*B^k + r2*B^2k + r3*B^3k + r4*B^4k
+	for(size_t i = 0; i < total; i++)
+		r[i] = 0;
+	addShifted(r, total, r0, 0);
+	addShifted(r, total, r1, k);
+	addShifted(r, total, r2, 2 * k);
+	addShifted(r, total, r3, 3 * k);
+	addShifted(r, total, r4, 4 * k);
+}
+
+// ==================== MULTIPLICACIÓN POR NTT ====================
+
+// Primos NTT de la forma c * 2^k + 1 (raíz primitiva 3 en los tres). Cada
+// coeficiente de la convolución es una suma de como mucho min(an, bn) <= 2^22
+// productos de limbs: 2^22 * (2^32-1)^2 < p1*p2*p3 ~ 2^86, así que el CRT
+// reconstruye cada coeficiente de forma exacta trabajando con limbs enteros
+static const uint32_t NTT_PRIMES[3] = { 998244353u, 167772161u, 469762049u };
+static const uint32_t NTT_ROOT = 3;
+static const size_t NTT_MAX_POINTS = (size_t)1 << 23;  // Límite de 998244353 = 119*2^23+1
+
+/**
+ * @brief Exponenciación modular de 32 bits: b^e mod m
+ */
+static uint32_t powMod32(uint32_t b, uint64_t e, uint32_t m)
+{
+	uint64_t res = 1;
+	uint64_t base = b % m;
+	while(e > 0)
+	{
+		if(e & 1)
+			res = res * base % m;
+		base = base * base % m;
+		e >>= 1;
+	}
+	return((uint32_t)res);
+}
+
+/**
+ * @brief Producto de Montgomery de 32 bits: a * b * 2^-32 mod p
+ * Evita la división de 64 bits en el bucle interno de la NTT
+ * @param np -p^-1 mod 2^32
+ */
+static inline uint32_t montMul32(uint32_t a, uint32_t b, uint32_t p, uint32_t np)
+{
+	uint64_t t = (uint64_t)a * b;
+	uint32_t m = (uint32_t)t * np;
+	uint32_t u = (uint32_t)((t + (uint64_t)m * p) >> 32);
+	return((u >= p) ? u - p : u);
+}
+
+/**
+ * @brief Calcula -p^-1 mod 2^32 por iteración de Newton (p impar)
+ */
+static uint32_t montNegInv32(uint32_t p)
+{
+	uint32_t inv = p;  // Correcto en los 3 bits bajos
+	for(int i = 0; i < 4; i++)
+		inv *= 2 - p * inv;
+	return(0u - inv);
+}
+
+/**
+ * @brief Transformada teórico-numérica in-place (Cooley-Tukey iterativa)
+ * Las raíces se guardan en forma de Montgomery, de modo que montMul32(x, w)
+ * devuelve directamente x * w mod p
+ * @param a Coeficientes (tamaño potencia de 2)
+ * @param invert true para la transformada inversa (sin el factor 1/n)
+ * @param mod Primo NTT
+ */
+static void ntt(limb_vector& a, bool invert, uint32_t mod)
+{
+	size_t n = a.size();
+	uint32_t np = montNegInv32(mod);
+
+	// Permutación bit-reversal
+	for(size_t i = 1, j = 0; i < n; i++)
+	{
+		size_t bit = n >> 1;
+		for(; j & bit; bit >>= 1)
+			j ^= bit;
+		j ^= bit;
+		if(i < j)
+		{
+			uint32_t t = a[i];
+			a[i] = a[j];
+			a[j] = t;
+		}
+	}
+
+	limb_vector roots(n / 2);
+	for(size_t len = 2; len <= n; len <<= 1)
+	{
+		uint32_t w = powMod32(NTT_ROOT, (mod - 1) / len, mod);
+		if(invert)
+			w = powMod32(w, mod - 2, mod);
+		size_t half = len / 2;
+		// Potencias de w en forma de Montgomery (x * 2^32 mod p)
+		uint32_t wMont = (uint32_t)(((uint64_t)w << 32) % mod);
+		roots[0] = (uint32_t)(((uint64_t)1 << 32) % mod);
+		for(size_t k = 1; k < half; k++)
+			roots[k] = montMul32(roots[k - 1], wMont, mod, np);
+		for(size_t i = 0; i < n; i += len)
+		{
+			uint32_t* lo = &a[i];
+			uint32_t* hi = &a[i + half];
+			for(size_t k = 0; k < half; k++)
+			{
+				uint32_t u = lo[k];
+				uint32_t v = montMul32(hi[k], roots[k], mod, np);
+				lo[k] = (u + v >= mod) ? u + v - mod : u + v;
+				hi[k] = (u >= v) ? u - v : u + mod - v;
+			}
+		}
+	}
+}
+
+/**
+ * @brief Convolución de dos arrays de limbs módulo un primo NTT
+ * @param a Salida: coeficientes del producto módulo mod (ya con tamaño n,
+ * potencia de 2; solo se escribe, nunca se redimensiona)
+ */
+static void nttConvolve(limb_vector& a, const limb* fa, size_t an,
+	const limb* fb, size_t bn, uint32_t mod)
+{
+	size_t n = a.size();
+	uint32_t np = montNegInv32(mod);
+	limb_vector b(n, 0);
+	for(size_t i = 0; i < an; i++)
+		a[i] = fa[i] % mod;
+	for(size_t i = an; i < n; i++)
+		a[i] = 0;
+	for(size_t i = 0; i < bn; i++)
+		b[i] = fb[i] % mod;
+	ntt(a, false, mod);
+	ntt(b, false, mod);
+
+	// El producto puntual de Montgomery deja un factor 2^-32 y la inversa
+	// un factor n; ambos se compensan al final con montMul32(x, n^-1 * 2^64)
+	uint64_t invN = powMod32((uint32_t)(n % mod), mod - 2, mod);
+	uint64_t r2 = ((uint64_t)1 << 32) % mod;
+	r2 = r2 * r2 % mod;
+	uint32_t scale = (uint32_t)(invN * r2 % mod);
+	for(size_t i = 0; i < n; i++)
+		a[i] = montMul32(a[i], b[i], mod, np);
+	ntt(a, true, mod);
+	for(size_t i = 0; i < n; i++)
+		a[i] = montMul32(a[i], scale, mod, np);
+}
+
+/**
+ * @brief La convolución módulo uno de los primos, para forkJoin
+ */
+struct nttTask
+{
+	limb_vector* out;
+	const limb* a;
+	size_t an;
+	const limb* b;
+	size_t bn;
+	uint32_t mod;
+};
+
+static void runNttTask(void* arg)
+{
+	const nttTask& t = *(const nttTask*)arg;
+	bigint::scratch_scope scope;
+	nttConvolve(*t.out, t.a, t.an, t.b, t.bn, t.mod);
+}
+
+/**
+ * @brief Suma v a un acumulador de 128 bits (hi:lo)
+ */
+static void add128(uint64_t& hi, uint64_t& lo, uint64_t v)
+{
+	lo += v;
+	if(lo < v)
+		hi++;
+}
+
+/**
+ * @brief Multiplicación por NTT con tres primos y reconstrucción por CRT
+ * O(n log n); exacta para an + bn <= NTT_MAX_POINTS limbs
+ * @param r Destino (an + bn limbs, no puede solaparse con a ni b)
+ */
+static void mulNTT(limb* r, const limb* a, size_t an, const limb* b, size_t bn)
+{
+	const uint64_t p1 = NTT_PRIMES[0];
+	const uint64_t p2 = NTT_PRIMES[1];
+	const uint64_t p3 = NTT_PRIMES[2];
+
+	size_t total = an + bn;
+	size_t n = 1;
+	while(n < total)
+		n <<= 1;
+
+	// Las tres convoluciones son independientes: van juntas a forkJoin
+	limb_vector c[3] = { limb_vector(n), limb_vector(n), limb_vector(n) };
+	nttTask tasks[3];
+	void* args[3];
+	for(size_t i = 0; i < 3; i++)
+	{
+		tasks[i].out = &c[i];
+		tasks[i].a = a;
+		tasks[i].an = an;
+		tasks[i].b = b;
+		tasks[i].bn = bn;
+		tasks[i].mod = NTT_PRIMES[i];
+		args[i] = &tasks[i];
+	}
+	forkJoin(runNttTask, args, 3, bn);
+	const limb_vector& c1 = c[0];
+	const limb_vector& c2 = c[1];
+	const limb_vector& c3 = c[2];
+
+	// Constantes de Garner
+	const uint64_t inv_p1_mod_p2 = powMod32((uint32_t)(p1 % p2), p2 - 2, (uint32_t)p2);
+	const uint64_t p1p2_mod_p3 = (p1 % p3) * (p2 % p3) % p3;
+	const uint64_t inv_p1p2_mod_p3 = powMod32((uint32_t)p1p2_mod_p3, p3 - 2, (uint32_t)p3);
+	const uint64_t p1p2 = p1 * p2;  // < 2^58
+	const uint64_t p1p2_lo = p1p2 & 0xFFFFFFFFu;
+	const uint64_t p1p2_hi = p1p2 >> 32;
+
+	// Reconstrucción x = r1 + p1*t2 + p1*p2*t3 y propagación del carry en base 2^32
+	uint64_t hi = 0;
+	uint64_t lo = 0;
+	for(size_t i = 0; i < total; i++)
+	{
+		uint64_t r1 = c1[i];
+		uint64_t r2 = c2[i];
+		uint64_t r3 = c3[i];
+		uint64_t t2 = (r2 + p2 - r1 % p2) % p2 * inv_p1_mod_p2 % p2;
+		uint64_t x12 = r1 + p1 * t2;  // < p1*p2
+		uint64_t t3 = (r3 + p3 - x12 % p3) % p3 * inv_p1p2_mod_p3 % p3;
+
+		add128(hi, lo, x12);
+		add128(hi, lo, p1p2_lo * t3);
+		uint64_t mid = p1p2_hi * t3;  // Se suma desplazado 32 bits
+		add128(hi, lo, mid << 32);
+		hi += mid >> 32;
+
+		r[i] = (limb)lo;
+		lo = (lo >> 32) | (hi << 32);
+		hi >>= 32;
+	}
+}
+
+/**
+ * @brief Multiplicación de arrays normalizados: elige el algoritmo por tamaño
+ * Escolar por debajo de karatsuba_threshold, Karatsuba en el rango medio,
+ * Toom-3 a partir de toom3_threshold y NTT a partir de ntt_threshold
+ * (medido sobre el operando más corto)
+ * @param r Destino (an + bn limbs, no puede solaparse con a ni b)
+ * @param a Operando largo (an >= bn >= 1)
+ * @param b Operando corto
+ */
+static void mulLimbs(limb* r, const limb* a, size_t an, const limb* b, size_t bn)
+{
+	if(bn < bigint::karatsuba_threshold)
+	{
+		mulSchoolbook(r, a, an, b, bn);
+		return;
+	}
+	if(bn >= bigint::ntt_threshold && an + bn <= NTT_MAX_POINTS)
+	{
+		mulNTT(r, a, an, b, bn);
+		return;
+	}
+	if(bn <= (an + 1) / 2)
+	{
+		mulUnbalanced(r, a, an, b, bn);
+		return;
+	}
+	if(bn >= bigint::toom3_threshold && bn > 2 * ((an + 2) / 3))
+	{
+		mulToom3(r, a, an, b, bn);
+		return;
+	}
+	mulKaratsuba(r, a, an, b, bn);
+}
+
+// ==================== NÚCLEOS DE DIVISIÓN ====================
+
+// Tamaño (en limbs del divisor y del cociente) a partir del cual la división
+// usa el recíproco de Newton en lugar del algoritmo D de Knuth
+size_t bigint::newton_threshold = 1500;
+
+/**
+ * @brief Número de ceros a la izquierda de un limb distinto de 0
+ */
+static unsigned int leadingZeros(limb x)
+{
+	unsigned int n = 0;
+	if((x & 0xFFFF0000u) == 0) { n += 16; x <<= 16; }
+	if((x & 0xFF000000u) == 0) { n += 8; x <<= 8; }
+	if((x & 0xF0000000u) == 0) { n += 4; x <<= 4; }
+	if((x & 0xC0000000u) == 0) { n += 2; x <<= 2; }
+	if((x & 0x80000000u) == 0) { n += 1; }
+	return(n);
+}
+
+/**
+ * @brief División corta por un limb: q = a / d
+ * @param q Cociente (n limbs, puede coincidir con a)
+ * @param a Dividendo (n limbs)
+ * @param d Divisor (distinto de 0)
+ * @return Resto
+ */
+static limb divRem1(limb* q, const limb* a, size_t n, limb d)
+{
+	uint64_t rem = 0;
+	for(size_t i = n; i > 0; i--)
+	{
+		uint64_t cur = (rem << 32) | a[i - 1];
+		q[i - 1] = (limb)(cur / d);
+		rem = cur % d;
+	}
+	return((limb)rem);
+}
+
+/**
+ * @brief División larga (Knuth, TAOCP vol. 2, algoritmo D)
+ * Normaliza el divisor para que su limb alto tenga el bit superior a 1;
+ * así la estimación de cada limb del cociente falla como mucho por 2
+ * @param q Cociente (m - n + 1 limbs)
+ * @param r Resto (n limbs)
+ * @param u Dividendo (m limbs)
+ * @param v Divisor (n limbs, n >= 2, v[n-1] != 0, m >= n)
+ */
+static void divKnuth(limb* q, limb* r, const limb* u, size_t m, const limb* v, size_t n)
+{
+	const uint64_t base = (uint64_t)1 << 32;
+	unsigned int s = leadingZeros(v[n - 1]);
+	limb_vector vn(n);
+	limb_vector un(m + 1);
+
+	// D1: normalizar
+	for(size_t i = n - 1; i > 0; i--)
+		vn[i] = (v[i] << s) | (s ? (limb)((uint64_t)v[i - 1] >> (32 - s)) : 0);
+	vn[0] = v[0] << s;
+	un[m] = s ? (limb)((uint64_t)u[m - 1] >> (32 - s)) : 0;
+	for(size_t i = m - 1; i > 0; i--)
+		un[i] = (u[i] << s) | (s ? (limb)((uint64_t)u[i - 1] >> (32 - s)) : 0);
+	un[0] = u[0] << s;
+
+	for(size_t j = m - n + 1; j-- > 0; )
+	{
+		// D3: estimar qhat con los dos limbs altos
+		uint64_t num = ((uint64_t)un[j + n] << 32) | un[j + n - 1];
+		uint64_t qhat = num / vn[n - 1];
+		uint64_t rhat = num % vn[n - 1];
+		while(qhat >= base || qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2]))
+		{
+			qhat--;
+			rhat += vn[n - 1];
+			if(rhat >= base)
+				break;
+		}
+
+		// D4: multiplicar y restar
+		int64_t borrow = 0;
+		int64_t t;
+		for(size_t i = 0; i < n; i++)
+		{
+			uint64_t p = qhat * vn[i];
+			t = (int64_t)un[i + j] - borrow - (int64_t)(p & 0xFFFFFFFFu);
+			un[i + j] = (limb)t;
+			borrow = (int64_t)(p >> 32) - (t >> 32);
+		}
+		t = (int64_t)un[j + n] - borrow;
+		un[j + n] = (limb)t;
+
+		// D5/D6: si la resta fue negativa, qhat era uno de más: sumar de vuelta
+		q[j] = (limb)qhat;
+		if(t < 0)
+		{
+			q[j]--;
+			limb carry = addN(&un[j], &un[j], &vn[0], n);
+			un[j + n] += carry;
+		}
+	}
+
+	// D8: desnormalizar el resto
+	for(size_t i = 0; i < n; i++)
+		r[i] = (un[i] >> s) | (s ? (limb)((uint64_t)un[i + 1] << (32 - s)) : 0);
+}
+
+/**
+ * @brief Convierte un valor con signo no negativo en vector de limbs
+ */
+static signedLimbs fromVector(const limb_vector& v)
+{
+	signedLimbs res;
+	res.mag = v;
+	res.neg = false;
+	return(res);
+}
+
+/**
+ * @brief B^k como valor con signo (B = 2^32)
+ */
+static signedLimbs powB(size_t k)
+{
+	signedLimbs res;
+	res.mag.assign(k + 1, 0);
+	res.mag[k] = 1;
+	res.neg = false;
+	return(res);
+}
+
+/**
+ * @brief floor(x / B^k) para un valor con signo (redondeo hacia -infinito)
+ */
+static signedLimbs signedShiftDown(const signedLimbs& x, size_t k)
+{
+	signedLimbs res;
+	res.neg = false;
+	if(x.mag.size() > k)
+		res.mag.assign(x.mag.begin() + k, x.mag.end());
+	if(x.neg)
+	{
+		// Si se descartó algo distinto de 0, floor de un negativo resta 1 más
+		bool inexact = false;
+		for(size_t i = 0; i < k && i < x.mag.size() && !inexact; i++)
+			inexact = (x.mag[i] != 0);
+		if(inexact)
+		{
+			res.mag.push_back(0);
+			propagateCarry(&res.mag[0], res.mag.size(), 1);
+			res.mag.resize(normSize(&res.mag[0], res.mag.size()));
+		}
+		res.neg = !res.mag.empty();
+	}
+	return(res);
+}
+
+/**
+ * @brief Recíproco entero aproximado de B^k / d por iteración de Newton
+ * Calcula recursivamente el recíproco con la mitad de precisión (usando solo
+ * los limbs altos de d), lo escala y aplica un paso de Newton
+ * y <- y + y * (B^k - d*y) / B^k, que duplica los limbs correctos. Cada
+ * nivel cuesta un par de multiplicaciones del tamaño de ese nivel, así que
+ * el total es un múltiplo pequeño de una multiplicación completa
+ * @param d Divisor normalizado (n limbs)
+ * @param k Exponente (k >= n)
+ * @return floor(B^k / d) con un error de unas pocas unidades, que corrige
+ * quien lo usa
+ */
+static limb_vector reciprocal(const limb* d, size_t n, size_t k)
+{
+	size_t p = k - n;  // El resultado tiene p + 1 limbs como mucho
+	// Con p < 4 la mitad de precisión (p/2 + 1) ya no reduce el problema
+	if(p < bigint::newton_threshold || p < 4 || n == 1)
+	{
+		limb_vector num(k + 1, 0);
+		num[k] = 1;
+		limb_vector q(k + 2 - n, 0);
+		if(n == 1)
+		{
+			q.resize(k + 1);
+			divRem1(&q[0], &num[0], k + 1, d[0]);
+		}
+		else
+		{
+			limb_vector rem(n);
+			divKnuth(&q[0], &rem[0], &num[0], k + 1, d, n);
+		}
+		q.resize(normSize(&q[0], q.size()));
+		return(q);
+	}
+
+	// Aproximación con la mitad de precisión sobre los limbs altos de d
+	size_t h = p / 2 + 1;
+	size_t m = (n < h + 2) ? n : h + 2;
+	limb_vector half = reciprocal(d + (n - m), m, m + h);
+	signedLimbs y;
+	y.neg = false;
+	y.mag.assign(p - h, 0);
+	y.mag.insert(y.mag.end(), half.begin(), half.end());
+
+	// Paso de Newton: y += floor(y * (B^k - d*y) / B^k)
+	signedLimbs dv = toSigned(d, n);
+	signedLimbs e = signedSub(powB(k), signedMul(dv, y));
+	y = signedAdd(y, signedShiftDown(signedMul(y, e), k));
+	return(y.mag);
+}
+
+/**
+ * @brief División por recíproco de Newton: q = floor(a / d), r = a - q*d
+ * Con y = floor(B^m / d) y m = longitud de a, floor(a*y / B^m) se queda
+ * como mucho 1 por debajo del cociente real
+ */
+static void divNewton(limb_vector& q, limb_vector& r,
+	const limb_vector& a, const limb_vector& d)
+{
+	size_t m = a.size();
+	signedLimbs av = fromVector(a);
+	signedLimbs dv = fromVector(d);
+	signedLimbs y = fromVector(reciprocal(&d[0], d.size(), m));
+
+	signedLimbs qv = signedShiftDown(signedMul(av, y), m);
+	signedLimbs rv = signedSub(av, signedMul(qv, dv));
+	signedLimbs one = toSigned(NULL, 0);
+	one.mag.push_back(1);
+	while(rv.neg)
+	{
+		qv = signedSub(qv, one);
+		rv = signedAdd(rv, dv);
+	}
+	while(cmpLimbs(rv.mag.empty() ? NULL : &rv.mag[0], rv.mag.size(), &d[0], d.size()) >= 0)
+	{
+		qv = signedAdd(qv, one);
+		rv = signedSub(rv, dv);
+	}
+	q.swap(qv.mag);
+	r.swap(rv.mag);
+}
+
+/**
+ * @brief División entera de vectores normalizados: elige el algoritmo
+ * Corta para divisores de un limb, Knuth D en el rango medio y Newton
+ * cuando divisor y cociente superan newton_threshold limbs
+ * @param q Cociente (salida, normalizado)
+ * @param r Resto (salida, normalizado)
+ * @param a Dividendo
+ * @param d Divisor (distinto de 0)
+ */
+static void divmodLimbs(limb_vector& q, limb_vector& r,
+	const limb_vector& a, const limb_vector& d)
+{
+	if(cmpLimbs(a.empty() ? NULL : &a[0], a.size(), &d[0], d.size()) < 0)
+	{
+		q.clear();
+		r = a;
+		return;
+	}
+	size_t m = a.size();
+	size_t n = d.size();
+	if(n == 1)
+	{
+		q.resize(m);
+		limb rem = divRem1(&q[0], &a[0], m, d[0]);
+		q.resize(normSize(&q[0], m));
+		r.clear();
+		if(rem != 0)
+			r.push_back(rem);
+		return;
+	}
+	if(n >= bigint::newton_threshold && m - n >= bigint::newton_threshold)
+	{
+		divNewton(q, r, a, d);
+		return;
+	}
+	q.resize(m - n + 1);
+	r.resize(n);
+	divKnuth(&q[0], &r[0], &a[0], m, &d[0], n);
+	q.resize(normSize(&q[0], q.size()));
+	r.resize(normSize(&r[0], r.size()));
+}
+
+// ==================== CONVERSIÓN DECIMAL ====================
+
+// Por debajo de este tamaño la conversión cuadrática por bloques de 10^9 es
+// más rápida que partir el número con divisiones/multiplicaciones grandes
+static const size_t DECIMAL_NAIVE_LIMBS = 48;
+static const size_t DECIMAL_NAIVE_DIGITS = DECIMAL_NAIVE_LIMBS * DECIMAL_BASE_DIGITS;
+
+// Caché de potencias 10^(9 * 2^i), i = 0, 1, 2... (cada una es el cuadrado de
+// la anterior). Se comparte entre todas las conversiones y solo crece. Es un
+// array fijo para que un nivel ya calculado no se mueva nunca: otro hilo
+// puede estar leyéndolo mientras se añaden los siguientes
+static const size_t POW10_MAX_LEVELS = 64;
+static limb_vector pow10Cache[POW10_MAX_LEVELS];
+static size_t pow10Levels = 0;
+
+#ifdef BIGINT_HAS_THREADS
+static std::mutex pow10Lock;
+#endif
+
+/**
+ * @brief Asegura que la caché contiene 10^(9 * 2^i) para i <= level
+ * Solo se puede leer pow10Cache[i] después de pedirlo con esta llamada
+ */
+static void ensurePow10Levels(size_t level)
+{
+#ifdef BIGINT_HAS_THREADS
+	std::lock_guard<std::mutex> guard(pow10Lock);
+#endif
+	// La caché vive más que la operación: nada de la arena
+	scratchSuspend persistent;
+	if(pow10Levels == 0)
+		pow10Cache[pow10Levels++].assign(1, DECIMAL_BASE);
+	while(pow10Levels <= level)
+	{
+		const limb_vector& prev = pow10Cache[pow10Levels - 1];
+		limb_vector sq(2 * prev.size());
+		mulAny(&sq[0], &prev[0], prev.size(), &prev[0], prev.size());
+		sq.resize(normSize(&sq[0], sq.size()));
+		pow10Cache[pow10Levels++].swap(sq);
+	}
+}
+
+/**
+ * @brief Escribe x en decimal con el método cuadrático (bloques de 10^9)
+ * @param out String de salida (se añade al final)
+ * @param x Valor a convertir (se destruye)
+ * @param width Si no es 0, rellena con ceros a la izquierda hasta width dígitos
+ */
+static void appendDecimalNaive(std::string& out, limb_vector& x, size_t width)
+{
+	limb_vector chunks;  // Bloques de 9 dígitos, del menos al más significativo
+	while(!x.empty())
+		chunks.push_back(divSmall(x, DECIMAL_BASE));
+
+	std::string digits;
+	digits.reserve(chunks.size() * DECIMAL_BASE_DIGITS);
+	char buf[DECIMAL_BASE_DIGITS];
+	for(size_t i = chunks.size(); i > 0; i--)
+	{
+		limb chunk = chunks[i - 1];
+		for(size_t j = DECIMAL_BASE_DIGITS; j > 0; j--)
+		{
+			buf[j - 1] = (char)('0' + chunk % 10);
+			chunk /= 10;
+		}
+		// El bloque más significativo se imprime sin ceros a la izquierda
+		size_t skip = 0;
+		if(i == chunks.size())
+			while(skip < DECIMAL_BASE_DIGITS && buf[skip] == '0')
+				skip++;
+		digits.append(buf + skip, DECIMAL_BASE_DIGITS - skip);
+	}
+	if(width > digits.size())
+		out.append(width - digits.size(), '0');
+	out += digits;
+}
+
+/**
+ * @brief Conversión a decimal divide-y-vencerás
+ * Con x < 10^(9 * 2^(level+1)), parte x = q * 10^(9 * 2^level) + r y
+ * convierte q y r recursivamente (r siempre con relleno de ceros). El coste
+ * queda dominado por las divisiones del nivel superior: O(M(n) log n)
+ * @param out String de salida (se añade al final)
+ * @param x Valor a convertir
+ * @param level Nivel de la caché de potencias
+ * @param pad Si es true, escribe exactamente 9 * 2^(level+1) dígitos
+ */
+static void appendDecimal(std::string& out, limb_vector& x, size_t level, bool pad)
+{
+	size_t width = pad ? (DECIMAL_BASE_DIGITS << (level + 1)) : 0;
+	if(level == 0 || x.size() <= DECIMAL_NAIVE_LIMBS)
+	{
+		appendDecimalNaive(out, x, width);
+		return;
+	}
+	limb_vector q;
+	limb_vector r;
+	divmodLimbs(q, r, x, pow10Cache[level]);
+	x.clear();
+	if(pad || !q.empty())
+	{
+		appendDecimal(out, q, level - 1, pad);
+		appendDecimal(out, r, level - 1, true);
+	}
+	else
+		appendDecimal(out, r, level - 1, false);
+}
+
+/**
+ * @brief Obtiene la representación decimal del número
+ * Se genera bajo demanda: O(n²) por bloques de 10^9 para números pequeños y
+ * divide-y-vencerás con la caché de potencias de 10 para los grandes
+ * @return String que representa el número (sin ceros a la izquierda)
+ */
+std::string bigint::getStr() const
+{
+	if(this->limbs.empty())
+		return("0");
+
+	scratch_scope scope;
+	limb_vector tmp(this->limbs.begin(), this->limbs.end());
+	std::string result;
+	if(tmp.size() <= DECIMAL_NAIVE_LIMBS)
+	{
+		appendDecimalNaive(result, tmp, 0);
+		return(result);
+	}
+
+	// Nivel más bajo tal que x < (10^(9 * 2^level))^2
+	size_t level = 0;
+	ensurePow10Levels(level);
+	while(2 * pow10Cache[level].size() - 1 <= tmp.size())
+		ensurePow10Levels(++level);
+	result.reserve(tmp.size() * 32 / 3 + 1);  // log10(2^32) < 32/3
+	appendDecimal(result, tmp, level, false);
+	return(result);
+}
+
+/**
+ * @brief Convierte dígitos decimales a limbs con el método cuadrático
+ * Acumula bloques de 9 dígitos: x = x * 10^9 + bloque
+ */
+static void parseDecimalNaive(limb_vector& x, const char* s, size_t len)
+{
+	x.clear();
+	size_t first = len % DECIMAL_BASE_DIGITS;
+	if(first == 0)
+		first = DECIMAL_BASE_DIGITS;
+	for(size_t pos = 0; pos < len; )
+	{
+		size_t chunkLen = (pos == 0) ? first : DECIMAL_BASE_DIGITS;
+		limb chunk = 0;
+		for(size_t i = 0; i < chunkLen; i++)
+			chunk = chunk * 10 + (limb)(s[pos + i] - '0');
+		mulSmall(x, smallPow10((unsigned int)chunkLen));
+		x.push_back(0);
+		propagateCarry(&x[0], x.size(), chunk);
+		x.resize(normSize(&x[0], x.size()));
+		pos += chunkLen;
+	}
+}
+
+/**
+ * @brief Conversión decimal -> limbs divide-y-vencerás
+ * Parte el texto en x = alto * 10^(9 * 2^level) + bajo, con los últimos
+ * 9 * 2^level dígitos en bajo, y recombina con una multiplicación rápida
+ */
+static void parseDecimal(limb_vector& x, const char* s, size_t len)
+{
+	if(len <= DECIMAL_NAIVE_DIGITS)
+	{
+		parseDecimalNaive(x, s, len);
+		return;
+	}
+	size_t level = 0;
+	while((DECIMAL_BASE_DIGITS << (level + 1)) < len)
+		level++;
+	size_t lowLen = DECIMAL_BASE_DIGITS << level;
+
+	limb_vector hi;
+	limb_vector lo;
+	parseDecimal(hi, s, len - lowLen);
+	parseDecimal(lo, s + len - lowLen, lowLen);
+
+	ensurePow10Levels(level);
+	const limb_vector& p = pow10Cache[level];
+	x.assign(hi.size() + p.size() + 1, 0);
+	if(!hi.empty())
+		mulAny(&x[0], &hi[0], hi.size(), &p[0], p.size());
+	if(!lo.empty())
+		addInto(&x[0], x.size(), &lo[0], lo.size());
+	x.resize(normSize(&x[0], x.size()));
+}
+
+/**
+ * @brief Constructor desde texto decimal
+ * Acepta solo dígitos (se permiten ceros a la izquierda)
+ * @param str Número en base 10
+ * @throw std::invalid_argument si str está vacío o contiene algo que no es un dígito
+ */
+bigint::bigint(const std::string& str)
+{
+	if(str.empty())
+		throw std::invalid_argument("bigint: empty string");
+	for(size_t i = 0; i < str.size(); i++)
+	{
+		if(str[i] < '0' || str[i] > '9')
+			throw std::invalid_argument("bigint: invalid digit in \"" + str + "\"");
+	}
+	scratch_scope scope;
+	limb_vector tmp;
+	parseDecimal(tmp, str.data(), str.size());
+	storeLimbs(this->limbs, tmp);
+}
+
+// ==================== LECTURA EN FLUJO ====================
+
+// Dígitos por multiplica-y-suma: 10^19 < 2^64
+static const size_t PARSER_BLOCK_DIGITS = 19;
+
+// Hojas de 9 * 2^6 = 576 dígitos: por encima de DECIMAL_NAIVE_DIGITS, y de
+// tamaño 9 * 2^k para combinarlas con las potencias de pow10Cache
+static const size_t PARSER_LEAF_LEVEL = 6;
+static const size_t PARSER_LEAF_DIGITS = DECIMAL_BASE_DIGITS << PARSER_LEAF_LEVEL;
+
+/**
+ * @brief 10^n en 64 bits (n <= 19)
+ */
+static uint64_t pow10U64(size_t n)
+{
+	uint64_t p = 1;
+	for(size_t i = 0; i < n; i++)
+		p *= 10;
+	return(p);
+}
+
+/**
+ * @brief x = x * m + add con m y add de 64 bits, en una pasada
+ * m se parte en dos mitades de 32 bits; el carry de 64 bits cabe siempre:
+ * limb * (m >> 32) + 2 * (2^32 - 1) <= 2^64 - 1
+ * @param limbs Vector de limbs (little-endian): std::vector o limb_buffer
+ * @param m Multiplicador
+ * @param add Sumando
+ */
+template<class Buffer>
+static void mulAddSmall64(Buffer& limbs, uint64_t m, uint64_t add)
+{
+	uint64_t mLo = m & 0xFFFFFFFFu;
+	uint64_t mHi = m >> 32;
+	uint64_t carry = add;
+	for(size_t i = 0; i < limbs.size(); i++)
+	{
+		uint64_t lo = limbs[i] * mLo + (carry & 0xFFFFFFFFu);
+		uint64_t hi = limbs[i] * mHi + (lo >> 32) + (carry >> 32);
+		limbs[i] = (limb)lo;
+		carry = hi;
+	}
+	while(carry != 0)
+	{
+		limbs.push_back((limb)carry);
+		carry >>= 32;
+	}
+}
+
+/**
+ * @brief hi = hi * 10^(9 * 2^level) + lo, con lo < 10^(9 * 2^level)
+ */
+static void mergeDecimal(limb_buffer& hi, const limb_buffer& lo, size_t level)
+{
+	ensurePow10Levels(level);
+	const limb_vector& p = pow10Cache[level];
+	bigint::scratch_scope scope;
+	limb_vector x(hi.size() + p.size() + 1, 0);
+	if(!hi.empty())
+		mulAny(&x[0], &hi[0], hi.size(), &p[0], p.size());
+	if(!lo.empty())
+		addInto(&x[0], x.size(), &lo[0], lo.size());
+	x.resize(normSize(&x[0], x.size()));
+	storeLimbs(hi, x);
+}
+
+/**
+ * @brief Constructor: sin dígitos
+ */
+bigint::parser::parser() : segments(), leaf(), leafDigits(0), block(0), blockDigits(0), total(0)
+{
+}
+
+/**
+ * @brief Pliega el bloque pendiente en la hoja: leaf = leaf * 10^d + block
+ */
+void bigint::parser::flushBlock()
+{
+	if(this->blockDigits == 0)
+		return;
+	mulAddSmall64(this->leaf.limbs, pow10U64(this->blockDigits), this->block);
+	this->block = 0;
+	this->blockDigits = 0;
+}
+
+/**
+ * @brief Cierra la hoja actual y la combina con las anteriores
+ * Como al sumar 1 en binario: mientras las dos últimas tengan el mismo
+ * nivel se juntan en una del nivel siguiente
+ */
+void bigint::parser::pushLeaf()
+{
+	segment s;
+	s.level = PARSER_LEAF_LEVEL;
+	this->segments.push_back(s);
+	this->segments.back().value.limbs.swap(this->leaf.limbs);
+	this->leafDigits = 0;
+	size_t n = this->segments.size();
+	while(n >= 2 && this->segments[n - 2].level == this->segments[n - 1].level)
+	{
+		mergeDecimal(this->segments[n - 2].value.limbs, this->segments[n - 1].value.limbs,
+			this->segments[n - 1].level);
+		this->segments[n - 2].level++;
+		this->segments.pop_back();
+		n--;
+	}
+}
+
+/**
+ * @brief Añade dígitos por la derecha
+ * Se valida el trozo entero antes de tocar nada
+ * @param data Dígitos ('0'-'9')
+ * @param size Número de caracteres
+ * @throw std::invalid_argument si hay algo que no es un dígito
+ */
+void bigint::parser::feed(const char* data, size_t size)
+{
+	for(size_t i = 0; i < size; i++)
+	{
+		if(data[i] < '0' || data[i] > '9')
+			throw std::invalid_argument("bigint: invalid digit in stream");
+	}
+	for(size_t i = 0; i < size; i++)
+	{
+		this->block = this->block * 10 + (uint64_t)(data[i] - '0');
+		this->blockDigits++;
+		this->leafDigits++;
+		if(this->blockDigits == PARSER_BLOCK_DIGITS)
+			this->flushBlock();
+		if(this->leafDigits == PARSER_LEAF_DIGITS)
+		{
+			this->flushBlock();
+			this->pushLeaf();
+		}
+	}
+	this->total += size;
+}
+
+/**
+ * @brief Número de dígitos recibidos
+ */
+size_t bigint::parser::digits() const
+{
+	return(this->total);
+}
+
+/**
+ * @brief Valor de todos los dígitos recibidos; el parser queda vacío
+ * Junta la hoja a medias y los segmentos de menor a mayor: cada uno es más
+ * largo que todo lo que tiene a la derecha, así que el coste es geométrico
+ * @return Nuevo bigint con el valor
+ * @throw std::invalid_argument si no se ha recibido ningún dígito
+ */
+bigint bigint::parser::finish()
+{
+	if(this->total == 0)
+		throw std::invalid_argument("bigint: empty string");
+	this->flushBlock();
+	bigint result;
+	result.limbs.swap(this->leaf.limbs);
+	size_t resultDigits = this->leafDigits;
+	for(size_t i = this->segments.size(); i > 0; i--)
+	{
+		bigint& high = this->segments[i - 1].value;
+		high.shiftLeftDecimal(resultDigits);
+		high += result;
+		result.limbs.swap(high.limbs);
+		resultDigits += DECIMAL_BASE_DIGITS << this->segments[i - 1].level;
+	}
+	result.trim();
+	this->segments.clear();
+	this->leafDigits = 0;
+	this->total = 0;
+	return(result);
+}
+
+// ==================== OPERADORES ARITMÉTICOS ====================
+
+/**
+ * @brief Operador de suma
+ * Copia el operando más largo (reservando un limb extra para el carry)
+ * y suma el otro in-place sobre él
+ * @param other Otro bigint a sumar
+ * @return Nuevo bigint con el resultado
+ */
+bigint bigint::operator+(const bigint& other) const
+{
+	const bigint& big = (this->limbs.size() >= other.limbs.size()) ? *this : other;
+	const bigint& small = (this->limbs.size() >= other.limbs.size()) ? other : *this;
+	bigint temp;
+	temp.limbs.reserve(big.limbs.size() + 1);
+	temp.limbs.assign(big.limbs.begin(), big.limbs.end());
+	temp += small;
+	return(temp);
+}
+
+/**
+ * @brief Operador de suma y asignación
+ * Suma in-place sobre el buffer propio: solo crece si other es más
+ * largo o si el carry desborda por la parte más significativa
+ * @param other Otro bigint a sumar (puede ser *this)
+ * @return Referencia al objeto actual
+ */
+bigint& bigint::operator+=(const bigint& other)
+{
+	size_t n = other.limbs.size();
+	if(n == 0)
+		return(*this);
+	if(this->limbs.size() <= 2 && n <= 2)
+	{
+		// Valores de 64 bits: una suma nativa y el carry a un tercer limb
+		uint64_t a = toU64(this->limbs);
+		uint64_t sum = a + toU64(other.limbs);
+		if(sum >= a)
+			storeU64(this->limbs, sum);
+		else
+		{
+			this->limbs.resize(3);
+			this->limbs[0] = (limb)sum;
+			this->limbs[1] = (limb)(sum >> 32);
+			this->limbs[2] = 1;
+		}
+		return(*this);
+	}
+	if(this->limbs.size() < n)
+		this->limbs.resize(n, 0);
+
+	limb carry = addN(&this->limbs[0], &this->limbs[0], &other.limbs[0], n);
+	if(carry != 0)
+		carry = propagateCarry(&this->limbs[0] + n, this->limbs.size() - n, carry);
+	if(carry != 0)
+		this->limbs.push_back(carry);
+	return(*this);
+}
+
+/**
+ * @brief Operador de resta
+ * @param other Sustraendo (no mayor que *this)
+ * @return Nuevo bigint con el resultado
+ * @throw std::domain_error si other es mayor que *this
+ */
+bigint bigint::operator-(const bigint& other) const
+{
+	bigint temp(*this);
+	temp -= other;
+	return(temp);
+}
+
+/**
+ * @brief Operador de resta y asignación
+ * Resta in-place con propagación de borrow (mismo núcleo SIMD que la suma)
+ * @param other Sustraendo (no mayor que *this; puede ser *this)
+ * @return Referencia al objeto actual
+ * @throw std::domain_error si other es mayor que *this
+ */
+bigint& bigint::operator-=(const bigint& other)
+{
+	size_t n = other.limbs.size();
+	if(n == 0)
+		return(*this);
+	if(this->compare(other) < 0)
+		throw std::domain_error("bigint: negative result");
+	if(this->limbs.size() <= 2)
+	{
+		storeU64(this->limbs, toU64(this->limbs) - toU64(other.limbs));
+		return(*this);
+	}
+	subFrom(&this->limbs[0], this->limbs.size(), &other.limbs[0], n);
+	this->trim();
+	return(*this);
+}
+
+/**
+ * @brief Resta invertida in-place: *this = minuend - *this
+ * Extiende el buffer propio a la longitud de minuend y resta sobre él
+ * @param minuend Minuendo (no menor que *this)
+ * @return Referencia al objeto actual
+ * @throw std::domain_error si minuend es menor que *this
+ */
+bigint& bigint::subtractFrom(const bigint& minuend)
+{
+	if(minuend.compare(*this) < 0)
+		throw std::domain_error("bigint: negative result");
+	size_t n = minuend.limbs.size();
+	if(n == 0)
+		return(*this);
+	this->limbs.resize(n, 0);
+	subN(&this->limbs[0], &minuend.limbs[0], &this->limbs[0], n);
+	this->trim();
+	return(*this);
+}
+
+/**
+ * @brief Operador de multiplicación
+ * El algoritmo (escolar, Karatsuba, Toom-3 o NTT) se elige según el tamaño
+ * de los operandos
+ * @param other Otro bigint a multiplicar
+ * @return Nuevo bigint con el resultado
+ */
+bigint bigint::operator*(const bigint& other) const
+{
+	bigint temp;
+	if(this->limbs.empty() || other.limbs.empty())
+		return(temp);
+	if(this->limbs.size() == 1 && other.limbs.size() == 1)
+	{
+		storeU64(temp.limbs, (uint64_t)this->limbs[0] * other.limbs[0]);
+		return(temp);
+	}
+	scratch_scope scope;
+	temp.limbs.resize(this->limbs.size() + other.limbs.size());
+	mulAny(&temp.limbs[0], &this->limbs[0], this->limbs.size(),
+		&other.limbs[0], other.limbs.size());
+	temp.trim();
+	return(temp);
+}
+
+/**
+ * @brief Operador de multiplicación y asignación
+ * @param other Otro bigint a multiplicar (puede ser *this)
+ * @return Referencia al objeto actual
+ */
+bigint& bigint::operator*=(const bigint& other)
+{
+	bigint temp = (*this) * other;
+	this->limbs.swap(temp.limbs);
+	return(*this);
+}
+
+/**
+ * @brief División entera con resto en una sola pasada
+ * @param divisor Divisor (distinto de 0)
+ * @param quotient Recibe floor(*this / divisor)
+ * @param remainder Recibe *this % divisor
+ * @throw std::domain_error si divisor es 0
+ */
+void bigint::divmod(const bigint& divisor, bigint& quotient, bigint& remainder) const
+{
+	if(divisor.limbs.empty())
+		throw std::domain_error("bigint: division by zero");
+	if(this->limbs.size() <= 2 && divisor.limbs.size() <= 2)
+	{
+		// Valores de 64 bits: división nativa
+		uint64_t a = toU64(this->limbs);
+		uint64_t d = toU64(divisor.limbs);
+		storeU64(quotient.limbs, a / d);
+		storeU64(remainder.limbs, a % d);
+		return;
+	}
+	if(divisor.limbs.size() == 1)
+	{
+		// Divisor de un limb: división corta directamente sobre el buffer
+		limb d = divisor.limbs[0];
+		quotient.limbs = this->limbs;
+		limb rem = divRem1(&quotient.limbs[0], &quotient.limbs[0], quotient.limbs.size(), d);
+		quotient.trim();
+		storeU64(remainder.limbs, rem);
+		return;
+	}
+	scratch_scope scope;
+	limb_vector a(this->limbs.begin(), this->limbs.end());
+	limb_vector d(divisor.limbs.begin(), divisor.limbs.end());
+	limb_vector q;
+	limb_vector r;
+	divmodLimbs(q, r, a, d);
+	storeLimbs(quotient.limbs, q);
+	storeLimbs(remainder.limbs, r);
+}
+
+/**
+ * @brief Operador de división entera
+ * @param other Divisor (distinto de 0)
+ * @return Nuevo bigint con el cociente
+ */
+bigint bigint::operator/(const bigint& other) const
+{
+	bigint quotient;
+	bigint remainder;
+	this->divmod(other, quotient, remainder);
+	return(quotient);
+}
+
+/**
+ * @brief Operador de módulo
+ * @param other Divisor (distinto de 0)
+ * @return Nuevo bigint con el resto
+ */
+bigint bigint::operator%(const bigint& other) const
+{
+	bigint quotient;
+	bigint remainder;
+	this->divmod(other, quotient, remainder);
+	return(remainder);
+}
+
+/**
+ * @brief Operador de división y asignación
+ * @param other Divisor (distinto de 0)
+ * @return Referencia al objeto actual
+ */
+bigint& bigint::operator/=(const bigint& other)
+{
+	bigint remainder;
+	this->divmod(other, *this, remainder);
+	return(*this);
+}
+
+/**
+ * @brief Operador de módulo y asignación
+ * @param other Divisor (distinto de 0)
+ * @return Referencia al objeto actual
+ */
+bigint& bigint::operator%=(const bigint& other)
+{
+	bigint quotient;
+	this->divmod(other, quotient, *this);
+	return(*this);
+}
+
+/**
+ * @brief Vista de solo lectura sobre los limbs de un sumando
+ */
+struct termView
+{
+	const limb* data;
+	size_t size;
+};
+
+/**
+ * @brief Orden por número de limbs decreciente (para addColumns)
+ */
+static bool longerFirst(const termView& a, const termView& b)
+{
+	return(a.size > b.size);
+}
+
+/**
+ * @brief Suma fusionada de varios operandos
+ * Descarta los ceros, los ordena por longitud y hace un único recorrido por
+ * columnas sobre un buffer reservado de una vez
+ * @param terms Punteros a los sumandos (pueden repetirse)
+ * @param count Número de sumandos
+ * @return Nuevo bigint con la suma de todos
+ */
+bigint bigint::sumOf(const bigint* const* terms, size_t count)
+{
+	std::vector<termView> views;
+	views.reserve(count);
+	for(size_t i = 0; i < count; i++)
+	{
+		if(terms[i]->limbs.empty())
+			continue;
+		termView view;
+		view.data = terms[i]->limbs.data();
+		view.size = terms[i]->limbs.size();
+		views.push_back(view);
+	}
+	bigint result;
+	if(views.empty())
+		return(result);
+	if(views.size() == 1)
+	{
+		result.limbs.assign(views[0].data, views[0].data + views[0].size);
+		return(result);
+	}
+	std::sort(views.begin(), views.end(), longerFirst);
+
+	std::vector<const limb*> data(views.size());
+	std::vector<size_t> sizes(views.size());
+	for(size_t i = 0; i < views.size(); i++)
+	{
+		data[i] = views[i].data;
+		sizes[i] = views[i].size;
+	}
+	size_t n = sizes[0];
+	result.limbs.reserve(n + 2);
+	result.limbs.resize(n);
+	uint64_t carry = addColumns(&result.limbs[0], &data[0], &sizes[0], data.size());
+	while(carry != 0)
+	{
+		result.limbs.push_back((limb)carry);
+		carry >>= 32;
+	}
+	return(result);
+}
+
+// ==================== SUMA DE RANGOS ====================
+
+// Una columna admite 2^32 sumas de un limb antes de desbordar; propagar cada
+// pocos miles deja el trabajo pendiente acotado y el coste repartido
+static const size_t SUM_CARRY_INTERVAL = 4096;
+
+// Tramo mínimo (en limbs sumados) de cada tarea de parallelSumOf
+static const size_t PARALLEL_SUM_MIN_LIMBS = 64 * 1024;
+
+/**
+ * @brief Constructor: acumulado 0
+ */
+bigint::accumulator::accumulator() : columns(), dirty(0), pending(0)
+{
+}
+
+/**
+ * @brief Propaga los carries de las columnas tocadas
+ * Las de más allá de 'dirty' ya estaban normalizadas, así que el carry se
+ * apaga enseguida al llegar a ellas
+ */
+void bigint::accumulator::propagate()
+{
+	// columna <= (2^32 - 1) * (SUM_CARRY_INTERVAL + 1): el carry no desborda
+	uint64_t carry = 0;
+	size_t i = 0;
+	for(; i < this->dirty; i++)
+	{
+		carry += this->columns[i];
+		this->columns[i] = carry & 0xFFFFFFFFu;
+		carry >>= 32;
+	}
+	for(; carry != 0; i++)
+	{
+		if(i == this->columns.size())
+			this->columns.push_back(0);
+		carry += this->columns[i];
+		this->columns[i] = carry & 0xFFFFFFFFu;
+		carry >>= 32;
+	}
+	this->dirty = 0;
+	this->pending = 0;
+}
+
+/**
+ * @brief Suma un valor al acumulado: un add por limb, sin carry
+ * @param term Sumando
+ */
+void bigint::accumulator::add(const bigint& term)
+{
+	size_t n = term.limbs.size();
+	if(n == 0)
+		return;
+	// Con margen: los carries de la propagación caben sin volver a crecer
+	if(this->columns.size() <= n)
+		this->columns.resize(n + n / 8 + 2, 0);
+	const limb* src = term.limbs.data();
+	uint64_t* dst = &this->columns[0];
+	for(size_t i = 0; i < n; i++)
+		dst[i] += src[i];
+	if(n > this->dirty)
+		this->dirty = n;
+	if(++this->pending == SUM_CARRY_INTERVAL)
+		this->propagate();
+}
+
+/**
+ * @brief Suma de todo lo añadido
+ * Propaga sobre la copia de salida, sin tocar las columnas
+ * @return Nuevo bigint con la suma
+ */
+bigint bigint::accumulator::result() const
+{
+	bigint res;
+	size_t n = this->columns.size();
+	if(n == 0)
+		return(res);
+	res.limbs.resize(n);
+	uint64_t carry = 0;
+	for(size_t i = 0; i < n; i++)
+	{
+		carry += this->columns[i];
+		res.limbs[i] = (limb)carry;
+		carry >>= 32;
+	}
+	while(carry != 0)
+	{
+		res.limbs.push_back((limb)carry);
+		carry >>= 32;
+	}
+	res.trim();
+	return(res);
+}
+
+/**
+ * @brief Un tramo de parallelSumOf: suma terms[0, count) en *out
+ */
+struct sumTask
+{
+	const bigint* const* terms;
+	size_t count;
+	bigint* out;
+};
+
+static void runSumTask(void* arg)
+{
+	const sumTask& t = *(const sumTask*)arg;
+	bigint::accumulator acc;
+	for(size_t i = 0; i < t.count; i++)
+		acc.add(*t.terms[i]);
+	*t.out = acc.result();
+}
+
+/**
+ * @brief Suma repartida entre hilos de un array de punteros
+ * Parte el array en tramos con más o menos los mismos limbs (hasta 4 por
+ * hilo, para que el robo de trabajo equilibre la carga), suma cada tramo en
+ * su propio accumulator y junta los parciales con sumOf
+ * @param terms Punteros a los sumandos (pueden repetirse)
+ * @param count Número de sumandos
+ * @return Nuevo bigint con la suma de todos
+ */
+bigint bigint::parallelSumOf(const bigint* const* terms, size_t count)
+{
+	size_t total = 0;
+	for(size_t i = 0; i < count; i++)
+		total += terms[i]->limbs.size();
+	size_t chunks = std::min(getThreadCount() * 4, total / PARALLEL_SUM_MIN_LIMBS);
+	if(chunks < 2)
+	{
+		bigint result;
+		sumTask whole = { terms, count, &result };
+		runSumTask(&whole);
+		return(result);
+	}
+
+	std::vector<sumTask> work;
+	work.reserve(chunks);
+	size_t begin = 0;
+	size_t seen = 0;
+	for(size_t i = 0; i < count && work.size() + 1 < chunks; i++)
+	{
+		seen += terms[i]->limbs.size();
+		if(seen >= (work.size() + 1) * (total / chunks))
+		{
+			sumTask t = { terms + begin, i + 1 - begin, NULL };
+			work.push_back(t);
+			begin = i + 1;
+		}
+	}
+	sumTask last = { terms + begin, count - begin, NULL };
+	work.push_back(last);
+
+	std::vector<bigint> partial(work.size());
+	std::vector<void*> args(work.size());
+	std::vector<const bigint*> parts(work.size());
+	for(size_t i = 0; i < work.size(); i++)
+	{
+		work[i].out = &partial[i];
+		args[i] = &work[i];
+		parts[i] = &partial[i];
+	}
+	forkJoin(runSumTask, &args[0], args.size(), total);
+	return(sumOf(&parts[0], parts.size()));
+}
+
+// ==================== RAÍCES ENTERAS ====================
+
+/**
+ * @brief Comprueba r^n <= a sin desbordar 64 bits
+ */
+static bool powAtMost(uint64_t r, unsigned int n, uint64_t a)
+{
+	uint64_t p = 1;
+	for(unsigned int i = 0; i < n; i++)
+	{
+		if(r != 0 && p > a / r)
+			return(false);
+		p *= r;
+	}
+	return(true);
+}
+
+/**
+ * @brief Raíz n-ésima entera de un valor de 64 bits, bit a bit
+ * @param a Radicando
+ * @param n Índice (>= 2), así que la raíz cabe en 32 bits
+ */
+static uint64_t rootU64(uint64_t a, unsigned int n)
+{
+	uint64_t root = 0;
+	for(size_t i = 32; i > 0; i--)
+	{
+		uint64_t cand = root | ((uint64_t)1 << (i - 1));
+		if(powAtMost(cand, n, a))
+			root = cand;
+	}
+	return(root);
+}
+
+/**
+ * @brief Potencia por cuadrados sucesivos
+ * @return base^e
+ */
+static bigint powOf(const bigint& base, unsigned int e)
+{
+	bigint result(1);
+	bigint square(base);
+	while(e != 0)
+	{
+		if(e & 1)
+			result *= square;
+		e >>= 1;
+		if(e != 0)
+			square *= square;
+	}
+	return(result);
+}
+
+/**
+ * @brief Raíz cuadrada entera (redondeada hacia abajo)
+ * @return Mayor r tal que r * r <= *this
+ */
+bigint bigint::isqrt() const
+{
+	return(this->iroot(2));
+}
+
+/**
+ * @brief Raíz n-ésima entera (redondeada hacia abajo)
+ * La raíz tiene k = ceil(bits / n) bits. Se calcula recursivamente la raíz
+ * r de *this >> (n * h), que da los k - h bits altos; (r + 1) << h es
+ * entonces una cota superior con error relativo de 2^-(k-h) y un paso de
+ * Newton
+ *     x' = ((n - 1) * x + *this / x^(n-1)) / n
+ * lo eleva al cuadrado. Con h algo menor que k / 2 basta un paso por nivel
+ * para quedar en la raíz exacta o a una unidad; Newton entero desde arriba
+ * nunca baja de la raíz, así que se repite hasta que x^n <= *this. Los
+ * niveles van a la mitad de tamaño, de modo que el primero domina el coste
+ * @param n Índice de la raíz (1 devuelve el propio número)
+ * @return Mayor r tal que r^n <= *this
+ * @throw std::domain_error si n es 0
+ */
+bigint bigint::iroot(unsigned int n) const
+{
+	if(n == 0)
+		throw std::domain_error("bigint: zeroth root");
+	size_t bits = this->bitLength();
+	if(n == 1 || bits <= 1)
+		return(*this);
+	// 2^(bits-1) <= *this < 2^bits <= 2^n: la raíz es 1
+	if(bits <= n)
+		return(bigint(1));
+	if(bits <= 64)
+	{
+		bigint result;
+		storeU64(result.limbs, rootU64(toU64(this->limbs), n));
+		return(result);
+	}
+
+	size_t k = (bits + n - 1) / n;
+	size_t indexBits = 0;
+	for(unsigned int m = n; m != 0; m >>= 1)
+		indexBits++;
+	// Margen para el factor (n - 1) / 2 del error tras el paso de Newton
+	size_t h = (k > indexBits + 3) ? (k - indexBits - 2) / 2 : 0;
+	if(h == 0)
+	{
+		// Raíz de pocos bits frente al índice: se construye bit a bit
+		bigint root;
+		for(size_t i = k; i > 0; i--)
+		{
+			bigint cand(1);
+			cand.shiftLeftBits(i - 1);
+			cand += root;
+			if(powOf(cand, n) <= *this)
+				root = cand;
+		}
+		return(root);
+	}
+
+	bigint high(*this);
+	high.shiftRightBits(n * h);
+	bigint x = high.iroot(n);
+	++x;
+	x.shiftLeftBits(h);
+
+	bigint index(n);
+	bigint lower(n - 1);
+	bigint quotient;
+	bigint remainder;
+	bigint power = powOf(x, n - 1);
+	for(;;)
+	{
+		this->divmod(power, quotient, remainder);
+		x *= lower;
+		x += quotient;
+		x /= index;
+		// x^(n-1) sirve para comprobar x^n y como divisor del paso siguiente
+		power = powOf(x, n - 1);
+		if(power * x <= *this)
+			return(x);
+	}
+}
+
+// ==================== OPERADORES DE INCREMENTO ====================
+
+/**
+ * @brief Incremento prefijo (++x)
+ * Propaga el carry in-place: en promedio solo se toca un limb y solo se
+ * reserva memoria cuando el número gana un limb
+ * @return Referencia al objeto actual incrementado
+ */
+bigint& bigint::operator++()
+{
+	limb carry = 1;
+	if(!this->limbs.empty())
+		carry = propagateCarry(&this->limbs[0], this->limbs.size(), carry);
+	if(carry != 0)
+		this->limbs.push_back(carry);
+	return(*this);
+}
+
+/**
+ * @brief Incremento postfijo (x++)
+ * @return Copia del objeto antes del incremento
+ */
+bigint bigint::operator++(int)
+{
+	bigint temp = (*this);
+	++(*this);
+	return(temp);
+}
+
+
+// ==================== DESPLAZAMIENTOS BINARIOS ====================
+
+/**
+ * @brief Desplazamiento binario a la izquierda in-place (multiplica por 2^n)
+ * Mueve limbs enteros (n / 32) y reparte los n % 32 bits restantes entre
+ * limbs vecinos en una sola pasada: O(limbs)
+ * @param n Número de bits
+ * @return Referencia al objeto actual
+ * @throw std::length_error si el resultado supera limb_buffer::MAX_LIMBS
+ */
+bigint& bigint::shiftLeftBits(size_t n)
+{
+	size_t len = this->limbs.size();
+	if(len == 0 || n == 0)
+		return(*this);
+	size_t words = n / 32;
+	unsigned int bits = (unsigned int)(n % 32);
+	this->limbs.resize(len + words + 1, 0);
+	limb* r = &this->limbs[0];
+	if(bits == 0)
+	{
+		for(size_t i = len; i > 0; i--)
+			r[i - 1 + words] = r[i - 1];
+		r[len + words] = 0;
+	}
+	else
+	{
+		r[len + words] = r[len - 1] >> (32 - bits);
+		for(size_t i = len - 1; i > 0; i--)
+			r[i + words] = (r[i] << bits) | (r[i - 1] >> (32 - bits));
+		r[words] = r[0] << bits;
+	}
+	for(size_t i = 0; i < words; i++)
+		r[i] = 0;
+	this->trim();
+	return(*this);
+}
+
+/**
+ * @brief Desplazamiento binario a la derecha in-place (divide por 2^n)
+ * Descarta n / 32 limbs y reparte los n % 32 bits restantes: O(limbs)
+ * @param n Número de bits
+ * @return Referencia al objeto actual
+ */
+bigint& bigint::shiftRightBits(size_t n)
+{
+	size_t len = this->limbs.size();
+	size_t words = n / 32;
+	unsigned int bits = (unsigned int)(n % 32);
+	if(words >= len)
+	{
+		this->limbs.clear();
+		return(*this);
+	}
+	if(n == 0)
+		return(*this);
+	limb* r = &this->limbs[0];
+	size_t newLen = len - words;
+	if(bits == 0)
+	{
+		for(size_t i = 0; i < newLen; i++)
+			r[i] = r[i + words];
+	}
+	else
+	{
+		for(size_t i = 0; i + 1 < newLen; i++)
+			r[i] = (r[i + words] >> bits) | (r[i + words + 1] << (32 - bits));
+		r[newLen - 1] = r[len - 1] >> bits;
+	}
+	this->limbs.resize(newLen);
+	this->trim();
+	return(*this);
+}
+
+/**
+ * @brief Número de bits significativos (0 para el valor 0)
+ * @return Posición del bit más alto a 1, más uno
  */
-bigint::bigint(unsigned int num)
+size_t bigint::bitLength() const
 {
-	std::stringstream ss;
-	ss << num;
-	this->str = ss.str();
+	size_t len = this->limbs.size();
+	if(len == 0)
+		return(0);
+	return(len * 32 - leadingZeros(this->limbs[len - 1]));
 }
 
 /**
- * @brief Constructor de copia
- * @param source Objeto bigint a copiar
+ * @brief Consulta un bit del valor binario
+ * @param i Posición del bit (0 = menos significativo)
+ * @return true si el bit i está a 1
  */
-bigint::bigint(const bigint& source)
+bool bigint::testBit(size_t i) const
 {
-	(*this) = source;
+	if(i / 32 >= this->limbs.size())
+		return(false);
+	return(((this->limbs[i / 32] >> (i % 32)) & 1) != 0);
 }
 
-// ==================== OPERADORES DE ASIGNACIÓN ====================
+// ==================== DESPLAZAMIENTOS DECIMALES ====================
+
+// A partir de este desplazamiento se multiplica/divide por 5^n y se
+// desplaza n bits (10^n = 5^n * 2^n) en vez de ir en bloques de 10^9
+static const size_t DECIMAL_SHIFT_POW_DIGITS = 9 * 16;
+
+// log2(10) / 32: limbs que añade cada dígito decimal
+static const double LIMBS_PER_DIGIT = 0.10381025296523008;
 
 /**
- * @brief Operador de asignación
- * @param source Objeto bigint a asignar
- * @return Referencia al objeto actual
+ * @brief Calcula 5^n por cuadrados sucesivos
+ * @param n Exponente
+ * @return 5^n
  */
-bigint& bigint::operator=(const bigint& source)
+static bigint pow5(size_t n)
 {
-	if(this == &source)
-		return(*this);
-	this->str = source.str;
-	return(*this);
+	bigint result(1);
+	bigint base(5);
+	while(true)
+	{
+		if(n & 1)
+			result *= base;
+		n >>= 1;
+		if(n == 0)
+			break;
+		base *= base;
+	}
+	return(result);
 }
 
-// ==================== GETTERS ====================
-
 /**
- * @brief Obtiene la representación string del número
- * @return String que representa el número
+ * @brief Convierte un contador bigint a size_t si cabe
+ * @param limbs Limbs normalizados del contador
+ * @param out Recibe el valor
+ * @return false si el valor no cabe en un size_t
  */
-std::string bigint::getStr() const
+static bool toSize(const limb_buffer& limbs, size_t& out)
 {
-	return(this->str);
+	if(limbs.size() * 32 > sizeof(size_t) * 8)
+		return(false);
+	out = 0;
+	for(size_t i = limbs.size(); i > 0; i--)
+		out = (out << 16 << 16) | limbs[i - 1];
+	return(true);
 }
 
-// ==================== FUNCIONES AUXILIARES ====================
-
 /**
- * @brief Invierte un string
- * @param str String a invertir
- * @return String invertido
+ * @brief Desplazamiento decimal a la izquierda in-place (multiplica por 10^n)
+ * Con n pequeño multiplica en bloques de 10^9; con n grande multiplica por
+ * 5^n y desplaza n bits. El tamaño del resultado se estima antes de calcular
+ * 5^n, así que un n desorbitado falla al momento en vez de tras minutos
+ * @param n Número de dígitos
+ * @return Referencia al objeto actual
+ * @throw std::length_error si el resultado supera limb_buffer::MAX_LIMBS
  */
-std::string reverse(const std::string& str)
+bigint& bigint::shiftLeftDecimal(size_t n)
 {
-	std::string revStr;
-	for(size_t i = str.length(); i > 0; i--)
+	if(this->limbs.empty() || n == 0)
+		return(*this);
+	if((double)n * LIMBS_PER_DIGIT + (double)this->limbs.size() + 1 > (double)this->limbs.max_size())
+		throw std::length_error("bigint: shift count too large");
+	if(n >= DECIMAL_SHIFT_POW_DIGITS)
+	{
+		(*this) *= pow5(n);
+		return(this->shiftLeftBits(n));
+	}
+	while(n >= DECIMAL_BASE_DIGITS)
 	{
-		revStr.push_back(str[i - 1]);
+		mulSmall(this->limbs, DECIMAL_BASE);
+		n -= DECIMAL_BASE_DIGITS;
 	}
-	return(revStr);
+	if(n > 0)
+		mulSmall(this->limbs, smallPow10((unsigned int)n));
+	return(*this);
 }
 
 /**
- * @brief Realiza la suma de dos bigint
- * Algoritmo: suma dígito por dígito con carry
- * @param obj1 Primer bigint
- * @param obj2 Segundo bigint
- * @return String con el resultado de la suma
+ * @brief Desplazamiento decimal a la derecha in-place (divide por 10^n)
+ * Si 10^n supera seguro al valor el resultado es 0 sin calcular nada; con n
+ * grande desplaza n bits y divide por 5^n (floor(floor(x/2^n)/5^n) = floor(x/10^n))
+ * @param n Número de dígitos
+ * @return Referencia al objeto actual
  */
-std::string addition(const bigint& obj1, const bigint& obj2)
+bigint& bigint::shiftRightDecimal(size_t n)
 {
-	// Invertir strings para facilitar la suma
-	std::string str1 = reverse(obj1.getStr());
-	std::string str2 = reverse(obj2.getStr());
-	std::string result;
-	size_t len1 = str1.length();
-	size_t len2 = str2.length();
-
-	// Igualar longitudes con ceros a la derecha
-	if(len1 > len2)
+	// value < 2^(32 * len) < 10^(10 * len)
+	if(n / 10 >= this->limbs.size())
 	{
-		int diff = len1 - len2;
-		while(diff > 0)
-		{
-			str2.push_back('0');
-			diff--;
-		}
+		this->limbs.clear();
+		return(*this);
 	}
-	else if(len2 > len1)
+	if(n >= DECIMAL_SHIFT_POW_DIGITS)
 	{
-		int diff = len2 - len1;
-		while(diff > 0)
-		{
-			str1.push_back('0');
-			diff--;
-		}
+		this->shiftRightBits(n);
+		(*this) /= pow5(n);
+		return(*this);
 	}
-
-	// Sumar dígito por dígito con carry
-	int carry = 0;
-	int digit1;
-	int digit2;
-	size_t len = str1.length();
-	for(size_t i = 0; i < len; i++)
+	while(n >= DECIMAL_BASE_DIGITS && !this->limbs.empty())
 	{
-		digit1 = str1[i] - '0';
-		digit2 = str2[i] - '0';
-		int res = digit1 + digit2 + carry;
-		
-		if(res > 9)
-		{
-			carry = res / 10;
-			result.push_back((res % 10) + '0');
-		}
-		else
-		{
-			carry = 0;  // ¡IMPORTANTE! Resetear carry
-			result.push_back(res + '0');
-		}
+		divSmall(this->limbs, DECIMAL_BASE);
+		n -= DECIMAL_BASE_DIGITS;
 	}
-	
-	// Si queda carry, agregarlo
-	if(carry != 0)
-		result.push_back(carry + '0');
-	
-	return(reverse(result));
-}
-
-// ==================== OPERADORES ARITMÉTICOS ====================
-
-/**
- * @brief Operador de suma
- * @param other Otro bigint a sumar
- * @return Nuevo bigint con el resultado
- */
-bigint bigint::operator+(const bigint& other) const
-{
-	bigint temp(other);
-	temp.str.clear();
-	std::string result = addition(*this, other);
-	temp.str = result;
-	return(temp);
-}
-
-/**
- * @brief Operador de suma y asignación
- * @param other Otro bigint a sumar
- * @return Referencia al objeto actual
- */
-bigint& bigint::operator+=(const bigint& other)
-{
-	(*this) = (*this) + other;
+	if(n > 0 && !this->limbs.empty())
+		divSmall(this->limbs, smallPow10((unsigned int)n));
 	return(*this);
 }
 
-// ==================== OPERADORES DE INCREMENTO ====================
-
 /**
- * @brief Incremento prefijo (++x)
- * @return Referencia al objeto actual incrementado
+ * @brief Desplazamiento decimal a la izquierda con contador bigint
+ * @param n Número de dígitos (cualquier tamaño)
+ * @return Referencia al objeto actual
+ * @throw std::length_error si el resultado supera limb_buffer::MAX_LIMBS
  */
-bigint& bigint::operator++()
+bigint& bigint::shiftLeftDecimal(const bigint& n)
 {
-	*(this) = *(this) + bigint(1);
-	return(*this);
+	size_t count;
+	if(this->limbs.empty())
+		return(*this);
+	if(!toSize(n.limbs, count))
+		throw std::length_error("bigint: shift count too large");
+	return(this->shiftLeftDecimal(count));
 }
 
 /**
- * @brief Incremento postfijo (x++)
- * @return Copia del objeto antes del incremento
+ * @brief Desplazamiento decimal a la derecha con contador bigint
+ * Un contador que no cabe en size_t deja siempre el valor a 0
+ * @param n Número de dígitos (cualquier tamaño)
+ * @return Referencia al objeto actual
  */
-bigint bigint::operator++(int)
+bigint& bigint::shiftRightDecimal(const bigint& n)
 {
-	bigint temp = (*this);
-	*(this) = *(this) + bigint(1);
-	return(temp);
+	size_t count;
+	if(!toSize(n.limbs, count))
+	{
+		this->limbs.clear();
+		return(*this);
+	}
+	return(this->shiftRightDecimal(count));
 }
 
-
 // ==================== OPERADORES DE DESPLAZAMIENTO (CON ENTERO) ====================
 
 /**
  * @brief Desplazamiento a la izquierda (multiplicación por 10^n)
  * @param n Número de posiciones a desplazar
  * @return Nuevo bigint desplazado
+ * @throw std::length_error si el resultado supera limb_buffer::MAX_LIMBS
  */
 bigint bigint::operator<<(unsigned int n) const
 {
-	bigint temp = *this;
-	// Agregar n ceros al final (multiplicar por 10^n)
-	temp.str.insert(temp.str.end(), n, '0');
+	bigint temp(*this);
+	temp.shiftLeftDecimal((size_t)n);
 	return(temp);
 }
 
@@ -214,17 +3359,8 @@ bigint bigint::operator<<(unsigned int n) const
  */
 bigint bigint::operator>>(unsigned int n) const
 {
-	bigint temp = *this;
-	size_t len = temp.str.length();
-	
-	// Si n es mayor o igual a la longitud, resultado es 0
-	if(n >= len)
-		temp.str = "0";
-	else
-	{
-		// Eliminar n caracteres desde el final
-		temp.str.erase(temp.str.length() - n, n);
-	}
+	bigint temp(*this);
+	temp.shiftRightDecimal((size_t)n);
 	return(temp);
 }
 
@@ -232,11 +3368,11 @@ bigint bigint::operator>>(unsigned int n) const
  * @brief Desplazamiento a la izquierda y asignación
  * @param n Número de posiciones a desplazar
  * @return Referencia al objeto actual
+ * @throw std::length_error si el resultado supera limb_buffer::MAX_LIMBS
  */
 bigint& bigint::operator<<=(unsigned int n)
 {
-	(*this) = (*this) << n;
-	return(*this);
+	return(this->shiftLeftDecimal((size_t)n));
 }
 
 /**
@@ -246,21 +3382,7 @@ bigint& bigint::operator<<=(unsigned int n)
  */
 bigint& bigint::operator>>=(unsigned int n)
 {
-	(*this) = (*this) >> n;
-	return(*this);
-}
-
-/**
- * @brief Convierte string a unsigned int
- * @param str String a convertir
- * @return Entero sin signo
- */
-unsigned int stringToUINT(std::string str)
-{
-	std::stringstream ss(str);
-	unsigned int res;
-	ss >> res;
-	return (res);
+	return(this->shiftRightDecimal((size_t)n));
 }
 
 // ==================== OPERADORES DE DESPLAZAMIENTO (CON BIGINT) ====================
@@ -269,11 +3391,12 @@ unsigned int stringToUINT(std::string str)
  * @brief Desplazamiento a la izquierda con bigint
  * @param other Bigint que indica las posiciones a desplazar
  * @return Nuevo bigint desplazado
+ * @throw std::length_error si el resultado supera limb_buffer::MAX_LIMBS
  */
 bigint bigint::operator<<(const bigint& other) const
 {
-	bigint temp;
-	temp = (*this) << stringToUINT(other.str);
+	bigint temp(*this);
+	temp.shiftLeftDecimal(other);
 	return(temp);
 }
 
@@ -284,8 +3407,8 @@ bigint bigint::operator<<(const bigint& other) const
  */
 bigint bigint::operator>>(const bigint& other) const
 {
-	bigint temp;
-	temp = (*this) >> stringToUINT(other.str);
+	bigint temp(*this);
+	temp.shiftRightDecimal(other);
 	return(temp);
 }
 
@@ -293,11 +3416,11 @@ bigint bigint::operator>>(const bigint& other) const
  * @brief Desplazamiento a la izquierda y asignación con bigint
  * @param other Bigint que indica las posiciones a desplazar
  * @return Referencia al objeto actual
+ * @throw std::length_error si el resultado supera limb_buffer::MAX_LIMBS
  */
 bigint& bigint::operator<<=(const bigint& other)
 {
-	(*this) = (*this) << stringToUINT(other.str);
-	return(*this);
+	return(this->shiftLeftDecimal(other));
 }
 
 /**
@@ -307,13 +3430,25 @@ bigint& bigint::operator<<=(const bigint& other)
  */
 bigint& bigint::operator>>=(const bigint& other)
 {
-	(*this) = (*this) >> stringToUINT(other.str);
-	return(*this);
+	return(this->shiftRightDecimal(other));
 }
 
-
 // ==================== OPERADORES DE COMPARACIÓN ====================
 
+/**
+ * @brief Comparación de tres vías
+ * Sin copias ni memoria dinámica: primero el número de limbs (O(1), los
+ * valores están normalizados) y, si coincide, limb a limb desde el más
+ * significativo hasta la primera diferencia
+ * @param other Otro bigint a comparar
+ * @return Negativo, 0 o positivo según *this sea menor, igual o mayor
+ */
+int bigint::compare(const bigint& other) const
+{
+	return(cmpLimbs(this->limbs.data(), this->limbs.size(),
+		other.limbs.data(), other.limbs.size()));
+}
+
 /**
  * @brief Operador de igualdad
  * @param other Otro bigint a comparar
@@ -321,9 +3456,7 @@ bigint& bigint::operator>>=(const bigint& other)
  */
 bool bigint::operator==(const bigint& other) const
 {
-	if(this->getStr() == other.getStr())
-		return(true);
-	return(false);
+	return(this->compare(other) == 0);
 }
 
 /**
@@ -333,7 +3466,7 @@ bool bigint::operator==(const bigint& other) const
  */
 bool bigint::operator!=(const bigint& other) const
 {
-	return(!((*this) == (other)));
+	return(this->compare(other) != 0);
 }
 
 /**
@@ -343,27 +3476,17 @@ bool bigint::operator!=(const bigint& other) const
  */
 bool bigint::operator<(const bigint& other) const
 {
-	std::string str1 = this->str;
-	std::string str2 = other.getStr();
-	size_t len1 = str1.length();
-	size_t len2 = str2.length();
-
-	// Si las longitudes son diferentes, el más corto es menor
-	if(len1 != len2)
-		return(len1 < len2);
-	
-	// Si las longitudes son iguales, comparar lexicográficamente
-	return(str1 < str2);
+	return(this->compare(other) < 0);
 }
 
 /**
  * @brief Operador mayor que
  * @param other Otro bigint a comparar
- * @return true si es mayor, false en caso contrario
+ * @return true si es mayor, false en caso contrario (también si son iguales)
  */
 bool bigint::operator>(const bigint& other) const
 {
-	return(!(((*this) < other)));
+	return(this->compare(other) > 0);
 }
 
 /**
@@ -373,7 +3496,7 @@ bool bigint::operator>(const bigint& other) const
  */
 bool bigint::operator<=(const bigint& other) const
 {
-	return((((*this) < other) || ((*this) == other)));
+	return(this->compare(other) <= 0);
 }
 
 /**
@@ -383,7 +3506,326 @@ bool bigint::operator<=(const bigint& other) const
  */
 bool bigint::operator>=(const bigint& other) const
 {
-	return((((*this) > other) || ((*this) == other)));
+	return(this->compare(other) >= 0);
+}
+
+// ==================== HASH ====================
+
+/**
+ * @brief Mezcla final: reparte todos los bits de entrada por los de salida
+ * (el finalizador de splitmix64)
+ */
+static uint64_t mixHash(uint64_t h)
+{
+	h ^= h >> 30;
+	h *= 0xBF58476D1CE4E5B9ULL;
+	h ^= h >> 27;
+	h *= 0x94D049BB133111EBULL;
+	h ^= h >> 31;
+	return(h);
+}
+
+/**
+ * @brief Hash del valor, calculado directamente sobre los limbs
+ * Recorre los limbs de dos en dos como palabras de 64 bits con el esquema
+ * de MurmurHash64A: cada palabra se mezcla por separado (multiplicación,
+ * xor-desplazamiento, multiplicación) antes de entrar en el estado, así
+ * que valores dispersos (muchos limbs a 0) no se cancelan entre sí. El
+ * número de limbs entra en la semilla
+ * @return Hash de tamaño size_t
+ */
+size_t bigint::hash() const
+{
+	const uint64_t M = 0xC6A4A7935BD1E995ULL;
+	size_t n = this->limbs.size();
+	const limb* p = this->limbs.data();
+	uint64_t h = 0x9E3779B97F4A7C15ULL ^ ((uint64_t)n * M);
+	size_t i = 0;
+	for(; i + 1 < n; i += 2)
+	{
+		uint64_t k = p[i] | ((uint64_t)p[i + 1] << 32);
+		k *= M;
+		k ^= k >> 47;
+		k *= M;
+		h = (h ^ k) * M;
+	}
+	if(i < n)
+		h = (h ^ p[i]) * M;
+	return((size_t)mixHash(h));
+}
+
+// ==================== OPERADORES SOBRE TEMPORALES ====================
+
+#ifdef BIGINT_HAS_MOVE
+/**
+ * @brief Suma reutilizando el buffer del operando izquierdo temporal
+ * Así una cadena como (b << 10) + 42 no copia ningún intermedio
+ */
+bigint operator+(bigint&& left, const bigint& right)
+{
+	left += right;
+	return(std::move(left));
+}
+
+/**
+ * @brief Suma reutilizando el buffer del operando derecho temporal
+ */
+bigint operator+(const bigint& left, bigint&& right)
+{
+	right += left;
+	return(std::move(right));
+}
+
+/**
+ * @brief Suma de dos temporales: reutiliza el buffer del más largo
+ */
+bigint operator+(bigint&& left, bigint&& right)
+{
+	if(right.limbs.size() > left.limbs.size())
+	{
+		right += left;
+		return(std::move(right));
+	}
+	left += right;
+	return(std::move(left));
+}
+
+/**
+ * @brief Resta reutilizando el buffer del minuendo temporal
+ * @throw std::domain_error si right es mayor que left
+ */
+bigint operator-(bigint&& left, const bigint& right)
+{
+	left -= right;
+	return(std::move(left));
+}
+
+/**
+ * @brief Desplazamiento a la izquierda in-place sobre un temporal
+ */
+bigint operator<<(bigint&& left, unsigned int n)
+{
+	left <<= n;
+	return(std::move(left));
+}
+
+/**
+ * @brief Desplazamiento a la derecha in-place sobre un temporal
+ */
+bigint operator>>(bigint&& left, unsigned int n)
+{
+	left >>= n;
+	return(std::move(left));
+}
+
+/**
+ * @brief Desplazamiento a la izquierda con bigint in-place sobre un temporal
+ */
+bigint operator<<(bigint&& left, const bigint& n)
+{
+	left <<= n;
+	return(std::move(left));
+}
+
+/**
+ * @brief Desplazamiento a la derecha con bigint in-place sobre un temporal
+ */
+bigint operator>>(bigint&& left, const bigint& n)
+{
+	left >>= n;
+	return(std::move(left));
+}
+#endif
+
+// ==================== SERIALIZACIÓN BINARIA ====================
+
+/**
+ * @brief Lee un limb little-endian (sin requisitos de alineación)
+ */
+static limb loadLE32(const unsigned char* p)
+{
+	return((limb)p[0] | ((limb)p[1] << 8) | ((limb)p[2] << 16) | ((limb)p[3] << 24));
+}
+
+/**
+ * @brief Escribe un limb little-endian
+ */
+static void storeLE32(unsigned char* p, limb v)
+{
+	p[0] = (unsigned char)v;
+	p[1] = (unsigned char)(v >> 8);
+	p[2] = (unsigned char)(v >> 16);
+	p[3] = (unsigned char)(v >> 24);
+}
+
+/**
+ * @brief Bytes de la cabecera LEB128 para n limbs
+ */
+static size_t headerSize(size_t n)
+{
+	size_t bytes = 1;
+	while(n >= 0x80)
+	{
+		n >>= 7;
+		bytes++;
+	}
+	return(bytes);
+}
+
+/**
+ * @brief Bytes que ocupa el número serializado
+ * @return Tamaño de la cabecera más 4 bytes por limb
+ */
+size_t bigint::serializedSize() const
+{
+	return(headerSize(this->limbs.size()) + 4 * this->limbs.size());
+}
+
+/**
+ * @brief Serializa en un buffer del llamador
+ * @param out Destino (al menos serializedSize() bytes)
+ * @return Bytes escritos
+ */
+size_t bigint::serialize(unsigned char* out) const
+{
+	size_t n = this->limbs.size();
+	size_t pos = 0;
+	while(n >= 0x80)
+	{
+		out[pos++] = (unsigned char)(n | 0x80);
+		n >>= 7;
+	}
+	out[pos++] = (unsigned char)n;
+	for(size_t i = 0; i < this->limbs.size(); i++, pos += 4)
+		storeLE32(out + pos, this->limbs[i]);
+	return(pos);
+}
+
+/**
+ * @brief Serializa añadiendo al final de un vector
+ * @param out Vector de bytes (se añade, no se vacía)
+ */
+void bigint::serialize(std::vector<unsigned char>& out) const
+{
+	size_t start = out.size();
+	out.resize(start + this->serializedSize());
+	this->serialize(&out[start]);
+}
+
+/**
+ * @brief Lee un número serializado
+ * @param data Inicio de los bytes
+ * @param size Bytes disponibles
+ * @param out Recibe el valor
+ * @return Bytes consumidos
+ * @throw std::invalid_argument si los datos están truncados o no son
+ * una codificación válida
+ */
+size_t bigint::deserialize(const unsigned char* data, size_t size, bigint& out)
+{
+	bigint_view view;
+	size_t used = bigint_view::parse(data, size, view);
+	out = view.toBigint();
+	return(used);
+}
+
+// ==================== VISTA DE UN BIGINT SERIALIZADO ====================
+
+/**
+ * @brief Constructor por defecto: vista del 0
+ */
+bigint_view::bigint_view() : payload(NULL), count(0)
+{
+}
+
+/**
+ * @brief Apunta la vista a un número serializado
+ * Solo decodifica la cabecera y comprueba que el registro es válido: que
+ * cabe en los bytes disponibles y que el limb más alto no es 0
+ * @param data Inicio de los bytes
+ * @param size Bytes disponibles
+ * @param out Recibe la vista (solo si no se lanza)
+ * @return Bytes que ocupa el registro
+ * @throw std::invalid_argument si los datos están truncados o no son
+ * una codificación válida
+ */
+size_t bigint_view::parse(const unsigned char* data, size_t size, bigint_view& out)
+{
+	size_t n = 0;
+	size_t pos = 0;
+	for(unsigned int shift = 0; ; shift += 7)
+	{
+		if(pos == size)
+			throw std::invalid_argument("bigint: truncated binary data");
+		size_t bits = data[pos] & 0x7F;
+		if(shift >= sizeof(size_t) * 8 || ((bits << shift) >> shift) != bits)
+			throw std::invalid_argument("bigint: invalid binary length");
+		n |= bits << shift;
+		if((data[pos++] & 0x80) == 0)
+		{
+			// Sin bytes de relleno: 0x80 0x00 también valdría 0
+			if(bits == 0 && pos > 1)
+				throw std::invalid_argument("bigint: invalid binary length");
+			break;
+		}
+	}
+	if(n > (size - pos) / 4)
+		throw std::invalid_argument("bigint: truncated binary data");
+	if(n > 0 && loadLE32(data + pos + 4 * (n - 1)) == 0)
+		throw std::invalid_argument("bigint: non-canonical binary data");
+	out.payload = data + pos;
+	out.count = n;
+	return(pos + 4 * n);
+}
+
+/**
+ * @brief Número de limbs del valor
+ */
+size_t bigint_view::limbCount() const
+{
+	return(this->count);
+}
+
+/**
+ * @brief Limb i (0 el menos significativo), leído del buffer
+ * @param i Índice (< limbCount())
+ */
+bigint::limb bigint_view::limb(size_t i) const
+{
+	return(loadLE32(this->payload + 4 * i));
+}
+
+/**
+ * @brief Comparación de tres vías entre dos vistas, sin copiar
+ * Como las codificaciones son canónicas, decide primero la longitud
+ * @param other Otra vista
+ * @return Negativo, 0 o positivo según *this sea menor, igual o mayor
+ */
+int bigint_view::compare(const bigint_view& other) const
+{
+	if(this->count != other.count)
+		return((this->count < other.count) ? -1 : 1);
+	for(size_t i = this->count; i > 0; i--)
+	{
+		bigint::limb a = this->limb(i - 1);
+		bigint::limb b = other.limb(i - 1);
+		if(a != b)
+			return((a < b) ? -1 : 1);
+	}
+	return(0);
+}
+
+/**
+ * @brief Copia el valor a un bigint
+ * @return Nuevo bigint con el valor
+ */
+bigint bigint_view::toBigint() const
+{
+	bigint result;
+	result.limbs.resize(this->count);
+	for(size_t i = 0; i < this->count; i++)
+		result.limbs[i] = loadLE32(this->payload + 4 * i);
+	return(result);
 }
 
 // ==================== OPERADOR DE FLUJO ====================
@@ -399,3 +3841,51 @@ std::ostream& operator<<(std::ostream& output, const bigint& obj)
 	output << obj.getStr();
 	return(output);
 }
+
+/**
+ * @brief Operador de entrada para streams
+ * Lee directamente del streambuf y pasa los dígitos al parser en trozos de
+ * PARSER_CHUNK caracteres; el primer carácter que no es un dígito queda en
+ * el stream
+ * @param input Stream de entrada
+ * @param obj Recibe el valor (sin cambios si no hay ningún dígito)
+ * @return Referencia al stream (con failbit si no había ningún dígito)
+ */
+std::istream& operator>>(std::istream& input, bigint& obj)
+{
+	static const size_t PARSER_CHUNK = 4096;
+
+	std::istream::sentry guard(input);
+	if(!guard)
+		return(input);
+	std::streambuf* buf = input.rdbuf();
+	bigint::parser parser;
+	char chunk[PARSER_CHUNK];
+	size_t n = 0;
+	std::ios_base::iostate state = std::ios_base::goodbit;
+	for(;;)
+	{
+		int c = buf->sgetc();
+		if(c == std::char_traits<char>::eof())
+		{
+			state |= std::ios_base::eofbit;
+			break;
+		}
+		if(c < '0' || c > '9')
+			break;
+		chunk[n++] = (char)c;
+		if(n == PARSER_CHUNK)
+		{
+			parser.feed(chunk, n);
+			n = 0;
+		}
+		buf->sbumpc();
+	}
+	parser.feed(chunk, n);
+	if(parser.digits() == 0)
+		state |= std::ios_base::failbit;
+	else
+		obj = parser.finish();
+	input.setstate(state);
+	return(input);
+}
@@ -5,17 +5,106 @@
 #include <iostream>
 #include <string>
 #include <cstdlib>
+#include <vector>
+#include <stdint.h>
+#include <stdexcept>
+#include <algorithm>
+#include <new>
+
+// Las operaciones de movimiento requieren C++11; en C++98 la clase sigue
+// compilando y simplemente copia. Lo mismo std::hash<bigint>: en C++98
+// queda hash() para usarlo con un functor propio
+#if __cplusplus >= 201103L
+# define BIGINT_HAS_MOVE
+# define BIGINT_HAS_STD_HASH
+# include <functional>
+# include <utility>
+#endif
+
+/**
+ * @brief Buffer contiguo de limbs con optimización de valores pequeños (SBO)
+ *
+ * Hasta INLINE_LIMBS limbs (128 bits) se guardan dentro del propio objeto,
+ * sin memoria dinámica; solo al desbordar se pasa a un bloque en el heap.
+ * Ofrece el subconjunto de la interfaz de std::vector que usa bigint.
+ */
+class limb_buffer
+{
+	public:
+		typedef uint32_t value_type;
+		static const size_t INLINE_LIMBS = 4;  // 128 bits sin heap
+		// 2^32 - 1 limbs (16 GiB), o menos si el número de bits no cabe en size_t
+		static const size_t MAX_LIMBS = ((size_t)-1 >> 5) < 0xFFFFFFFFu ? ((size_t)-1 >> 5) : 0xFFFFFFFFu;
+
+	private:
+		value_type* ptr;                          // inline_data o bloque del heap
+		size_t len;                               // Limbs en uso
+		size_t cap;                               // Capacidad de ptr
+		value_type inline_data[INLINE_LIMBS];     // Almacenamiento interno
+
+		bool isInline() const { return(this->ptr == this->inline_data); }
+		void grow(size_t minCap);
+
+	public:
+		limb_buffer();
+		limb_buffer(const limb_buffer& source);
+		limb_buffer& operator=(const limb_buffer& source);
+#ifdef BIGINT_HAS_MOVE
+		limb_buffer(limb_buffer&& source) noexcept;
+		limb_buffer& operator=(limb_buffer&& source) noexcept;
+#endif
+		~limb_buffer();
+
+		size_t size() const { return(this->len); }
+		size_t max_size() const { return(MAX_LIMBS); }
+		bool empty() const { return(this->len == 0); }
+		value_type* data() { return(this->ptr); }
+		const value_type* data() const { return(this->ptr); }
+		const value_type* begin() const { return(this->ptr); }
+		const value_type* end() const { return(this->ptr + this->len); }
+		value_type& operator[](size_t i) { return(this->ptr[i]); }
+		const value_type& operator[](size_t i) const { return(this->ptr[i]); }
+		value_type& back() { return(this->ptr[this->len - 1]); }
+		const value_type& back() const { return(this->ptr[this->len - 1]); }
+
+		void push_back(value_type v)
+		{
+			if(this->len == this->cap)
+				this->grow(this->len + 1);
+			this->ptr[this->len++] = v;
+		}
+		void pop_back() { this->len--; }
+		void clear() { this->len = 0; }
+		void reserve(size_t n) { if(n > this->cap) this->grow(n); }
+		void resize(size_t n, value_type v = 0);
+		void assign(const value_type* first, const value_type* last);
+		void swap(limb_buffer& other);
+		bool operator==(const limb_buffer& other) const;
+};
 
 /**
  * @brief Clase para manejar números enteros de precisión arbitraria
  * 
  * Esta clase permite trabajar con números enteros más grandes que SIZE_MAX
- * sin pérdida de precisión, almacenándolos como strings.
+ * sin pérdida de precisión. El valor se guarda en binario como un array
+ * contiguo de limbs de 32 bits (base 2^32); la representación decimal solo
+ * se genera al imprimir o al llamar a getStr().
  */
 class bigint
 {
+	public:
+		typedef uint32_t limb;  // Un "dígito" en base 2^32
+
 	private:
-		std::string str;  // Almacena el número como string
+		// Limbs en orden little-endian (limbs[0] es el menos significativo).
+		// Siempre normalizado: sin limbs a cero en la cabecera; el 0 es el buffer vacío.
+		// Los valores de hasta 128 bits viven dentro del objeto (sin heap).
+		limb_buffer limbs;
+
+		/**
+		 * @brief Elimina los limbs a cero de la parte más significativa
+		 */
+		void trim();
 
 	public:
 		// ==================== CONSTRUCTORES ====================
@@ -30,6 +119,13 @@ class bigint
 		 * @param num Número entero a convertir
 		 */
 		bigint(unsigned int num);
+
+		/**
+		 * @brief Constructor desde texto decimal (conversión subcuadrática)
+		 * @param str Número en base 10, solo dígitos
+		 * @throw std::invalid_argument si str no es un número válido
+		 */
+		explicit bigint(const std::string& str);
 		
 		/**
 		 * @brief Constructor de copia
@@ -37,13 +133,62 @@ class bigint
 		 */
 		bigint(const bigint& source);
 
+#ifdef BIGINT_HAS_MOVE
+		/**
+		 * @brief Constructor de movimiento (reutiliza el buffer de source)
+		 * @param source Objeto bigint temporal
+		 */
+		bigint(bigint&& source) noexcept;
+#endif
+
 		// ==================== GETTERS ====================
 		/**
 		 * @brief Obtiene la representación string del número
+		 * Conversión divide-y-vencerás con una caché de potencias de 10
 		 * @return String que representa el número
 		 */
 		std::string getStr() const;
 
+		// ==================== SERIALIZACIÓN BINARIA ====================
+		// Formato: número de limbs en LEB128 (7 bits por byte; el bit alto
+		// indica que sigue otro) y después los limbs en little-endian, 4 bytes
+		// cada uno, del menos al más significativo. El 0 es un único byte 0x00.
+		// La codificación es única: el limb más alto nunca es 0
+
+		/**
+		 * @brief Bytes que ocupa el número serializado
+		 * @return Tamaño de la cabecera más 4 bytes por limb
+		 */
+		size_t serializedSize() const;
+
+		/**
+		 * @brief Serializa en un buffer del llamador
+		 * @param out Destino (al menos serializedSize() bytes)
+		 * @return Bytes escritos
+		 */
+		size_t serialize(unsigned char* out) const;
+
+		/**
+		 * @brief Serializa añadiendo al final de un vector
+		 * @param out Vector de bytes (se añade, no se vacía)
+		 */
+		void serialize(std::vector<unsigned char>& out) const;
+
+		/**
+		 * @brief Lee un número serializado
+		 * @param data Inicio de los bytes
+		 * @param size Bytes disponibles
+		 * @param out Recibe el valor
+		 * @return Bytes consumidos (el siguiente registro empieza ahí)
+		 * @throw std::invalid_argument si los datos están truncados o no son
+		 * una codificación válida
+		 */
+		static size_t deserialize(const unsigned char* data, size_t size, bigint& out);
+
+		// ==================== LECTURA EN FLUJO ====================
+		// Conversión decimal incremental (definida después de la clase)
+		class parser;
+
 		// ==================== OPERADORES DE ASIGNACIÓN ====================
 		/**
 		 * @brief Operador de asignación
@@ -52,6 +197,15 @@ class bigint
 		 */
 		bigint& operator=(const bigint& source);
 
+#ifdef BIGINT_HAS_MOVE
+		/**
+		 * @brief Operador de asignación por movimiento
+		 * @param source Objeto bigint temporal
+		 * @return Referencia al objeto actual
+		 */
+		bigint& operator=(bigint&& source) noexcept;
+#endif
+
 		// ==================== OPERADORES ARITMÉTICOS ====================
 		/**
 		 * @brief Operador de suma
@@ -67,6 +221,266 @@ class bigint
 		 */
 		bigint& operator+=(const bigint& other);
 
+		/**
+		 * @brief Operador de resta (bigint no tiene signo)
+		 * @param other Sustraendo (no mayor que *this)
+		 * @return Nuevo bigint con el resultado
+		 * @throw std::domain_error si other es mayor que *this
+		 */
+		bigint operator-(const bigint& other) const;
+
+		/**
+		 * @brief Operador de resta y asignación
+		 * @param other Sustraendo (no mayor que *this)
+		 * @return Referencia al objeto actual
+		 * @throw std::domain_error si other es mayor que *this
+		 */
+		bigint& operator-=(const bigint& other);
+
+		/**
+		 * @brief Resta invertida in-place: *this = minuend - *this
+		 * Evita la copia de minuend cuando el resultado debe quedarse aquí
+		 * (la usa signed_bigint al cambiar de signo)
+		 * @param minuend Minuendo (no menor que *this)
+		 * @return Referencia al objeto actual
+		 * @throw std::domain_error si minuend es menor que *this
+		 */
+		bigint& subtractFrom(const bigint& minuend);
+
+		/**
+		 * @brief Operador de multiplicación
+		 * Escolar, Karatsuba, Toom-3 o NTT según el tamaño de los operandos
+		 * @param other Otro bigint a multiplicar
+		 * @return Nuevo bigint con el resultado
+		 */
+		bigint operator*(const bigint& other) const;
+
+		/**
+		 * @brief Operador de multiplicación y asignación
+		 * @param other Otro bigint a multiplicar
+		 * @return Referencia al objeto actual
+		 */
+		bigint& operator*=(const bigint& other);
+
+		/**
+		 * @brief Operador de división entera
+		 * @param other Divisor (distinto de 0)
+		 * @return Nuevo bigint con el cociente
+		 * @throw std::domain_error si other es 0
+		 */
+		bigint operator/(const bigint& other) const;
+
+		/**
+		 * @brief Operador de módulo
+		 * @param other Divisor (distinto de 0)
+		 * @return Nuevo bigint con el resto
+		 * @throw std::domain_error si other es 0
+		 */
+		bigint operator%(const bigint& other) const;
+
+		/**
+		 * @brief Operador de división y asignación
+		 * @param other Divisor (distinto de 0)
+		 * @return Referencia al objeto actual
+		 */
+		bigint& operator/=(const bigint& other);
+
+		/**
+		 * @brief Operador de módulo y asignación
+		 * @param other Divisor (distinto de 0)
+		 * @return Referencia al objeto actual
+		 */
+		bigint& operator%=(const bigint& other);
+
+		/**
+		 * @brief División entera con resto en una sola pasada
+		 * Corta (un limb), Knuth D o recíproco de Newton según el tamaño
+		 * @param divisor Divisor (distinto de 0)
+		 * @param quotient Recibe el cociente
+		 * @param remainder Recibe el resto
+		 * @throw std::domain_error si divisor es 0
+		 */
+		void divmod(const bigint& divisor, bigint& quotient, bigint& remainder) const;
+
+		/**
+		 * @brief Suma fusionada de varios operandos
+		 * Una sola reserva y un solo recorrido por columnas con carry de 64
+		 * bits, en vez de un temporal por cada '+'. Es lo que evalúa
+		 * bigint_expr.hpp
+		 * @param terms Punteros a los sumandos (pueden repetirse)
+		 * @param count Número de sumandos
+		 * @return Nuevo bigint con la suma de todos
+		 */
+		static bigint sumOf(const bigint* const* terms, size_t count);
+
+		// ==================== SUMA DE RANGOS ====================
+		/**
+		 * @brief Acumulador de sumas con carry perezoso
+		 * Cada limb de cada sumando se suma a una columna de 64 bits sin
+		 * propagar nada; los carries se resuelven de golpe cada
+		 * SUM_CARRY_INTERVAL sumas (solo en las columnas tocadas) y al pedir
+		 * el resultado. El buffer crece con margen y no se recorta, así que
+		 * sumar muchos valores no redimensiona ni hace una pasada por cada uno
+		 */
+		class accumulator
+		{
+			private:
+				std::vector<uint64_t> columns;  // Columnas sin propagar
+				size_t dirty;                   // Columnas tocadas desde la última propagación
+				size_t pending;                 // Sumas desde la última propagación
+
+				void propagate();
+
+			public:
+				accumulator();
+
+				/**
+				 * @brief Suma un valor al acumulado
+				 * @param term Sumando
+				 */
+				void add(const bigint& term);
+
+				/**
+				 * @brief Suma de todo lo añadido (el acumulador no cambia)
+				 * @return Nuevo bigint con la suma
+				 */
+				bigint result() const;
+		};
+
+		/**
+		 * @brief Suma de un rango de bigint con un accumulator
+		 * Recorre el rango una sola vez, en orden
+		 * @param first Inicio del rango
+		 * @param last Fin del rango
+		 * @return Nuevo bigint con la suma (0 si el rango está vacío)
+		 */
+		template <typename InputIterator>
+		static bigint sum(InputIterator first, InputIterator last)
+		{
+			accumulator acc;
+			for(; first != last; ++first)
+				acc.add(*first);
+			return(acc.result());
+		}
+
+		/**
+		 * @brief Suma de un rango de bigint repartida entre hilos
+		 * Cada hilo acumula un tramo y los parciales se juntan con sumOf.
+		 * El resultado es el mismo que el de sum()
+		 * @param first Inicio del rango
+		 * @param last Fin del rango
+		 * @return Nuevo bigint con la suma (0 si el rango está vacío)
+		 */
+		template <typename ForwardIterator>
+		static bigint parallelSum(ForwardIterator first, ForwardIterator last)
+		{
+			std::vector<const bigint*> terms;
+			for(; first != last; ++first)
+				terms.push_back(&*first);
+			return(parallelSumOf(terms.empty() ? NULL : &terms[0], terms.size()));
+		}
+
+		/**
+		 * @brief Suma repartida entre hilos de un array de punteros
+		 * Tramos de al menos PARALLEL_SUM_MIN_LIMBS limbs; con un solo hilo
+		 * (o sin C++11) es un único accumulator
+		 * @param terms Punteros a los sumandos (pueden repetirse)
+		 * @param count Número de sumandos
+		 * @return Nuevo bigint con la suma de todos
+		 */
+		static bigint parallelSumOf(const bigint* const* terms, size_t count);
+
+		// ==================== RAÍCES ENTERAS ====================
+		/**
+		 * @brief Raíz cuadrada entera (redondeada hacia abajo)
+		 * @return Mayor r tal que r * r <= *this
+		 */
+		bigint isqrt() const;
+
+		/**
+		 * @brief Raíz n-ésima entera (redondeada hacia abajo)
+		 * Newton sobre la multiplicación y la división de bigint: la raíz de
+		 * la mitad alta del número da la estimación inicial, así que cada
+		 * nivel dobla la precisión y el coste total es un múltiplo pequeño
+		 * del de una división del tamaño del número
+		 * @param n Índice de la raíz (1 devuelve el propio número)
+		 * @return Mayor r tal que r^n <= *this
+		 * @throw std::domain_error si n es 0
+		 */
+		bigint iroot(unsigned int n) const;
+
+		// ==================== UMBRALES DE MULTIPLICACIÓN Y DIVISIÓN ====================
+		// Tamaño (en limbs del operando más corto) a partir del cual se usa
+		// cada algoritmo. Son ajustables para calibrarlos en cada máquina.
+		static size_t karatsuba_threshold;  // Escolar -> Karatsuba
+		static size_t toom3_threshold;      // Karatsuba -> Toom-3
+		static size_t ntt_threshold;        // Toom-3 -> NTT (tres primos + CRT)
+		static size_t newton_threshold;     // Knuth D -> recíproco de Newton (división)
+
+		// ==================== MEMORIA TEMPORAL ====================
+		/**
+		 * @brief Scope de memoria temporal del hilo actual
+		 * Mientras hay uno abierto, los temporales internos de las operaciones
+		 * (Karatsuba, Toom-3, NTT, división, conversión) se reservan avanzando
+		 * un puntero en una arena del hilo y se liberan todos juntos al
+		 * cerrarlo. Cada operación grande abre el suyo; abrir uno alrededor de
+		 * un lote mantiene la arena caliente durante todo el lote. Los bigint
+		 * en sí no viven en la arena: pueden salir del scope sin problema
+		 */
+		class scratch_scope
+		{
+			private:
+				void* chunk;     // Chunk actual al abrir
+				size_t used;     // Bytes ocupados en él al abrir
+
+				scratch_scope(const scratch_scope&);
+				scratch_scope& operator=(const scratch_scope&);
+
+			public:
+				scratch_scope();
+				~scratch_scope();
+		};
+
+		/**
+		 * @brief Devuelve al sistema la memoria guardada por el hilo actual
+		 * (arena de temporales y bloques de limbs reutilizables). En C++11
+		 * se hace sola al terminar el hilo
+		 */
+		static void releaseThreadMemory();
+
+		// ==================== NÚCLEO SIMD ====================
+		// La suma de arrays largos usa AVX2 si la CPU lo soporta (se detecta
+		// en tiempo de ejecución); con false se fuerza el bucle escalar
+		static bool simd_enabled;
+
+		/**
+		 * @brief Indica si la suma está usando el núcleo AVX2
+		 * @return true si está compilado, la CPU lo soporta y simd_enabled
+		 */
+		static bool simdAvailable();
+
+		// ==================== MULTIPLICACIÓN EN PARALELO ====================
+		// Con C++11, los productos grandes reparten sus subproductos (los de
+		// Karatsuba y Toom-3 y las tres convoluciones de la NTT) entre un pool
+		// de hilos con robo de trabajo. El resultado es idéntico, bit a bit,
+		// al de un solo hilo
+		static size_t parallel_threshold;   // Limbs del operando corto para repartir
+
+		/**
+		 * @brief Configura el número de hilos de los productos grandes
+		 * No debe llamarse mientras otro hilo está operando con bigint
+		 * @param count Hilos en total contando el que llama (0: uno por
+		 * núcleo, que es el valor inicial; 1: sin paralelismo). Sin C++11
+		 * no tiene efecto
+		 */
+		static void setThreadCount(size_t count);
+
+		/**
+		 * @brief Número de hilos de los productos grandes
+		 * @return Hilos en total (siempre 1 sin C++11)
+		 */
+		static size_t getThreadCount();
+
 		// ==================== OPERADORES DE INCREMENTO ====================
 		/**
 		 * @brief Incremento prefijo (++x)
@@ -80,11 +494,73 @@ class bigint
 		 */
 		bigint operator++(int);
 
+		// ==================== DESPLAZAMIENTOS BINARIOS ====================
+		/**
+		 * @brief Desplazamiento binario a la izquierda in-place (por 2^n)
+		 * @param n Número de bits
+		 * @return Referencia al objeto actual
+		 * @throw std::length_error si el resultado supera limb_buffer::MAX_LIMBS
+		 */
+		bigint& shiftLeftBits(size_t n);
+
+		/**
+		 * @brief Desplazamiento binario a la derecha in-place (entre 2^n)
+		 * @param n Número de bits
+		 * @return Referencia al objeto actual
+		 */
+		bigint& shiftRightBits(size_t n);
+
+		/**
+		 * @brief Número de bits significativos (0 para el valor 0)
+		 * @return Posición del bit más alto a 1, más uno
+		 */
+		size_t bitLength() const;
+
+		/**
+		 * @brief Consulta un bit del valor binario
+		 * @param i Posición del bit (0 = menos significativo)
+		 * @return true si el bit i está a 1
+		 */
+		bool testBit(size_t i) const;
+
+		// ==================== DESPLAZAMIENTOS DECIMALES ====================
+		// Mismo significado que los operadores << y >> (por/entre 10^n)
+		/**
+		 * @brief Desplazamiento decimal a la izquierda in-place (por 10^n)
+		 * @param n Número de dígitos
+		 * @return Referencia al objeto actual
+		 * @throw std::length_error si el resultado supera limb_buffer::MAX_LIMBS
+		 */
+		bigint& shiftLeftDecimal(size_t n);
+
+		/**
+		 * @brief Desplazamiento decimal a la derecha in-place (entre 10^n)
+		 * @param n Número de dígitos
+		 * @return Referencia al objeto actual
+		 */
+		bigint& shiftRightDecimal(size_t n);
+
+		/**
+		 * @brief Desplazamiento decimal a la izquierda con contador bigint
+		 * @param n Número de dígitos (cualquier tamaño)
+		 * @return Referencia al objeto actual
+		 * @throw std::length_error si el resultado supera limb_buffer::MAX_LIMBS
+		 */
+		bigint& shiftLeftDecimal(const bigint& n);
+
+		/**
+		 * @brief Desplazamiento decimal a la derecha con contador bigint
+		 * @param n Número de dígitos (cualquier tamaño; si es enorme da 0)
+		 * @return Referencia al objeto actual
+		 */
+		bigint& shiftRightDecimal(const bigint& n);
+
 		// ==================== OPERADORES DE DESPLAZAMIENTO (CON ENTERO) ====================
 		/**
 		 * @brief Desplazamiento a la izquierda (multiplicación por 10^n)
 		 * @param n Número de posiciones a desplazar
 		 * @return Nuevo bigint desplazado
+		 * @throw std::length_error si el resultado supera limb_buffer::MAX_LIMBS
 		 */
 		bigint operator<<(unsigned int n) const;
 		
@@ -99,6 +575,7 @@ class bigint
 		 * @brief Desplazamiento a la izquierda y asignación
 		 * @param n Número de posiciones a desplazar
 		 * @return Referencia al objeto actual
+		 * @throw std::length_error si el resultado supera limb_buffer::MAX_LIMBS
 		 */
 		bigint& operator<<=(unsigned int n);
 		
@@ -114,6 +591,7 @@ class bigint
 		 * @brief Desplazamiento a la izquierda con bigint
 		 * @param other Bigint que indica las posiciones a desplazar
 		 * @return Nuevo bigint desplazado
+		 * @throw std::length_error si el resultado supera limb_buffer::MAX_LIMBS
 		 */
 		bigint operator<<(const bigint& other) const;
 		
@@ -128,6 +606,7 @@ class bigint
 		 * @brief Desplazamiento a la izquierda y asignación con bigint
 		 * @param other Bigint que indica las posiciones a desplazar
 		 * @return Referencia al objeto actual
+		 * @throw std::length_error si el resultado supera limb_buffer::MAX_LIMBS
 		 */
 		bigint& operator<<=(const bigint& other);
 		
@@ -139,6 +618,14 @@ class bigint
 		bigint& operator>>=(const bigint& other);
 
 		// ==================== OPERADORES DE COMPARACIÓN ====================
+		/**
+		 * @brief Comparación de tres vías (sin copias ni memoria dinámica)
+		 * Respalda los seis operadores relacionales
+		 * @param other Otro bigint a comparar
+		 * @return Negativo, 0 o positivo según *this sea menor, igual o mayor
+		 */
+		int compare(const bigint& other) const;
+
 		/**
 		 * @brief Operador de igualdad
 		 * @param other Otro bigint a comparar
@@ -180,6 +667,161 @@ class bigint
 		 * @return true si es mayor o igual, false en caso contrario
 		 */
 		bool operator>=(const bigint& other) const;
+
+		// ==================== HASH ====================
+		/**
+		 * @brief Hash del valor, calculado directamente sobre los limbs
+		 * Sin copias ni paso por texto: un multiplica-y-rota por cada 64
+		 * bits y una mezcla final. Como los limbs están normalizados, dos
+		 * bigint iguales dan siempre el mismo hash
+		 * @return Hash de tamaño size_t
+		 */
+		size_t hash() const;
+
+		// Accede a los limbs para trabajar con arrays de tamaño fijo
+		friend class montgomery_context;
+		friend class bigint_view;
+		template <size_t Bits> friend class fixed_bigint;
+
+#ifdef BIGINT_HAS_MOVE
+		friend bigint operator+(bigint&& left, bigint&& right);
+#endif
+};
+
+#ifdef BIGINT_HAS_MOVE
+// ==================== OPERADORES SOBRE TEMPORALES ====================
+// Cuando un operando es un temporal se opera in-place sobre su buffer en vez
+// de copiarlo, así las cadenas de expresiones no hacen copias intermedias
+bigint operator+(bigint&& left, const bigint& right);
+bigint operator+(const bigint& left, bigint&& right);
+bigint operator+(bigint&& left, bigint&& right);
+bigint operator-(bigint&& left, const bigint& right);
+bigint operator<<(bigint&& left, unsigned int n);
+bigint operator>>(bigint&& left, unsigned int n);
+bigint operator<<(bigint&& left, const bigint& n);
+bigint operator>>(bigint&& left, const bigint& n);
+#endif
+
+// ==================== LECTURA EN FLUJO ====================
+/**
+ * @brief Conversión decimal incremental para textos que no caben en memoria
+ *
+ * Recibe los dígitos a trozos de cualquier tamaño y nunca guarda el
+ * texto: los va plegando en bloques de 19 dígitos (un multiplica-y-suma
+ * de 64 bits por bloque) dentro de hojas de PARSER_LEAF_DIGITS dígitos,
+ * y las hojas se combinan como un contador binario (dos de igual
+ * tamaño se juntan con una multiplicación rápida por la potencia de 10
+ * cacheada). El coste total es el de la conversión divide-y-vencerás
+ * y la memoria, la del propio resultado.
+ *
+ *     bigint::parser p;
+ *     while(leer(trozo))
+ *         p.feed(trozo.data(), trozo.size());
+ *     bigint x = p.finish();
+ */
+class bigint::parser
+{
+	private:
+		struct segment
+		{
+			bigint value;
+			size_t level;           // Tiene 9 * 2^level dígitos
+		};
+
+		std::vector<segment> segments;  // Niveles estrictamente decrecientes
+		bigint leaf;                    // Hoja en construcción
+		size_t leafDigits;
+		uint64_t block;                 // Bloque de hasta 19 dígitos
+		size_t blockDigits;
+		size_t total;                   // Dígitos recibidos
+
+		void flushBlock();
+		void pushLeaf();
+
+	public:
+		parser();
+
+		/**
+		 * @brief Añade dígitos por la derecha
+		 * @param data Dígitos ('0'-'9')
+		 * @param size Número de caracteres
+		 * @throw std::invalid_argument si hay algo que no es un dígito
+		 * (el trozo entero se descarta)
+		 */
+		void feed(const char* data, size_t size);
+
+		/**
+		 * @brief Número de dígitos recibidos
+		 */
+		size_t digits() const;
+
+		/**
+		 * @brief Valor de todos los dígitos recibidos; el parser queda vacío
+		 * @return Nuevo bigint con el valor
+		 * @throw std::invalid_argument si no se ha recibido ningún dígito
+		 */
+		bigint finish();
+};
+
+// ==================== VISTA DE UN BIGINT SERIALIZADO ====================
+/**
+ * @brief Vista de solo lectura sobre un bigint serializado
+ *
+ * Apunta a los bytes de otro (un buffer prestado, un fichero mapeado en
+ * memoria...) sin copiarlos: leer un registro solo decodifica la cabecera.
+ * Los bytes deben seguir vivos mientras se use la vista. Para operar con el
+ * valor se convierte con toBigint(), que hace la única copia.
+ *
+ *     bigint_view v;
+ *     for(size_t pos = 0; pos < size; )
+ *         pos += bigint_view::parse(data + pos, size - pos, v);
+ */
+class bigint_view
+{
+	private:
+		const unsigned char* payload;  // Primer byte del limb 0
+		size_t count;                  // Número de limbs
+
+	public:
+		/**
+		 * @brief Constructor por defecto: vista del 0
+		 */
+		bigint_view();
+
+		/**
+		 * @brief Apunta la vista a un número serializado
+		 * @param data Inicio de los bytes
+		 * @param size Bytes disponibles
+		 * @param out Recibe la vista (solo si no se lanza)
+		 * @return Bytes que ocupa el registro
+		 * @throw std::invalid_argument si los datos están truncados o no son
+		 * una codificación válida
+		 */
+		static size_t parse(const unsigned char* data, size_t size, bigint_view& out);
+
+		/**
+		 * @brief Número de limbs del valor
+		 */
+		size_t limbCount() const;
+
+		/**
+		 * @brief Limb i (0 el menos significativo), leído del buffer
+		 * @param i Índice (< limbCount())
+		 */
+		bigint::limb limb(size_t i) const;
+
+		/**
+		 * @brief Comparación de tres vías entre dos vistas, sin copiar
+		 * @param other Otra vista
+		 * @return Negativo, 0 o positivo según *this sea menor, igual o mayor
+		 */
+		int compare(const bigint_view& other) const;
+
+		/**
+		 * @brief Copia el valor a un bigint
+		 * @return Nuevo bigint con el valor
+		 */
+		bigint toBigint() const;
 };
 
 // ==================== OPERADOR DE FLUJO ====================
@@ -191,4 +833,33 @@ class bigint
  */
 std::ostream& operator<<(std::ostream& output, const bigint& obj);
 
+/**
+ * @brief Operador de entrada para streams
+ * Como con los enteros: salta los espacios iniciales (si skipws) y lee
+ * dígitos hasta el primer carácter que no lo es, que queda en el stream.
+ * Usa bigint::parser, así que no guarda el texto completo
+ * @param input Stream de entrada
+ * @param obj Recibe el valor (sin cambios si no hay ningún dígito)
+ * @return Referencia al stream (con failbit si no había ningún dígito)
+ */
+std::istream& operator>>(std::istream& input, bigint& obj);
+
+#ifdef BIGINT_HAS_STD_HASH
+// ==================== HASH PARA CONTENEDORES ====================
+/**
+ * @brief Permite usar bigint como clave de std::unordered_map/unordered_set
+ */
+namespace std
+{
+	template <>
+	struct hash<bigint>
+	{
+		size_t operator()(const bigint& value) const
+		{
+			return(value.hash());
+		}
+	};
+}
+#endif
+
 #endif
@@ -0,0 +1,157 @@
+#ifndef BIGINT_EXPR
+#define BIGINT_EXPR
+
+#include "bigint.hpp"
+
+/**
+ * @file bigint_expr.hpp
+ * @brief Plantillas de expresión (opcionales) para sumas de bigint
+ *
+ * Con los operadores normales, a + b + c + d crea un temporal por cada '+'.
+ * Envolviendo el primer operando con lazy(), la suma se construye como un
+ * árbol de referencias y no se calcula nada hasta asignarla a un bigint;
+ * entonces bigint::sumOf suma todos los operandos en una sola pasada:
+ *
+ *     bigint total = lazy(a) + b + c + d;   // una reserva, un recorrido
+ *     total += lazy(e) + f;                 // total + e + f, también fusionado
+ *
+ * La expresión solo guarda referencias a sus operandos: hay que evaluarla
+ * dentro de la misma sentencia en la que se construye.
+ */
+
+// ==================== BASE DE LAS EXPRESIONES ====================
+/**
+ * @brief Base CRTP de toda expresión de suma perezosa
+ * @tparam Derived Tipo concreto de la expresión
+ */
+template <class Derived>
+class bigint_expr
+{
+	public:
+		/**
+		 * @brief Acceso al tipo concreto
+		 */
+		const Derived& self() const
+		{
+			return(static_cast<const Derived&>(*this));
+		}
+
+		/**
+		 * @brief Evalúa la expresión con una única suma fusionada
+		 * @return bigint con el resultado
+		 */
+		bigint eval() const
+		{
+			std::vector<const bigint*> terms;
+			terms.reserve(this->self().size());
+			this->self().collect(terms);
+			return(bigint::sumOf(&terms[0], terms.size()));
+		}
+
+		/**
+		 * @brief Conversión implícita: permite bigint x = lazy(a) + b;
+		 */
+		operator bigint() const
+		{
+			return(this->eval());
+		}
+};
+
+// ==================== HOJA ====================
+/**
+ * @brief Hoja de la expresión: referencia a un bigint existente
+ */
+class bigint_term : public bigint_expr<bigint_term>
+{
+	private:
+		const bigint* value;
+
+	public:
+		explicit bigint_term(const bigint& value) : value(&value) {}
+
+		size_t size() const
+		{
+			return(1);
+		}
+
+		void collect(std::vector<const bigint*>& terms) const
+		{
+			terms.push_back(this->value);
+		}
+};
+
+// ==================== NODO SUMA ====================
+/**
+ * @brief Nodo suma: left + right, sin evaluar
+ * @tparam Left Expresión izquierda
+ * @tparam Right Expresión derecha
+ */
+template <class Left, class Right>
+class bigint_sum : public bigint_expr< bigint_sum<Left, Right> >
+{
+	private:
+		Left left;
+		Right right;
+
+	public:
+		bigint_sum(const Left& left, const Right& right) : left(left), right(right) {}
+
+		size_t size() const
+		{
+			return(this->left.size() + this->right.size());
+		}
+
+		void collect(std::vector<const bigint*>& terms) const
+		{
+			this->left.collect(terms);
+			this->right.collect(terms);
+		}
+};
+
+// ==================== CONSTRUCCIÓN ====================
+/**
+ * @brief Punto de entrada: convierte un bigint en hoja de expresión
+ * @param value bigint a envolver (debe vivir hasta evaluar la expresión)
+ * @return Hoja de expresión
+ */
+inline bigint_term lazy(const bigint& value)
+{
+	return(bigint_term(value));
+}
+
+template <class L, class R>
+inline bigint_sum<L, R> operator+(const bigint_expr<L>& left, const bigint_expr<R>& right)
+{
+	return(bigint_sum<L, R>(left.self(), right.self()));
+}
+
+template <class L>
+inline bigint_sum<L, bigint_term> operator+(const bigint_expr<L>& left, const bigint& right)
+{
+	return(bigint_sum<L, bigint_term>(left.self(), bigint_term(right)));
+}
+
+template <class R>
+inline bigint_sum<bigint_term, R> operator+(const bigint& left, const bigint_expr<R>& right)
+{
+	return(bigint_sum<bigint_term, R>(bigint_term(left), right.self()));
+}
+
+/**
+ * @brief target += expresión, fusionando target con el resto de sumandos
+ * @param target bigint acumulador (puede aparecer también en la expresión)
+ * @param expr Expresión de suma
+ * @return Referencia a target
+ */
+template <class E>
+inline bigint& operator+=(bigint& target, const bigint_expr<E>& expr)
+{
+	std::vector<const bigint*> terms;
+	terms.reserve(expr.self().size() + 1);
+	terms.push_back(&target);
+	expr.self().collect(terms);
+	target = bigint::sumOf(&terms[0], terms.size());
+	return(target);
+}
+
+#endif
@@ -0,0 +1,815 @@
+#ifndef FIXED_BIGINT
+#define FIXED_BIGINT
+
+#include "bigint.hpp"
+
+/**
+ * @file fixed_bigint.hpp
+ * @brief Enteros sin signo de ancho fijo (256, 512, 1024... bits) en la pila
+ *
+ * fixed_bigint<Bits> ofrece los mismos operadores que bigint, pero guarda
+ * siempre Bits / 32 limbs dentro del propio objeto: nada de heap ni de
+ * normalizar. La suma, la resta y la multiplicación se despliegan por
+ * completo en tiempo de compilación (una plantilla por limb) y todas las
+ * operaciones que no tocan texto ni streams son constexpr:
+ *
+ *     typedef fixed_bigint<256> u256;
+ *     constexpr u256 k = u256(1000000007) * u256(998244353);
+ *     u256 x(bigintValue);              // explícito: lanza si no cabe
+ *     bigint y(static_cast<bigint>(x)); // explícito, nunca falla
+ *
+ * Como los tipos sin signo nativos, la aritmética es módulo 2^Bits: la
+ * suma y la multiplicación que desbordan y la resta que daría negativo
+ * dan la vuelta en vez de lanzar. Las conversiones desde texto y desde
+ * bigint sí comprueban que el valor cabe.
+ *
+ * Requiere C++14 (constexpr con bucles); bigint.cpp no lo incluye.
+ */
+
+template <size_t Bits>
+class fixed_bigint
+{
+	static_assert(Bits > 0 && Bits % 32 == 0, "fixed_bigint: Bits debe ser un múltiplo de 32");
+
+	public:
+		typedef bigint::limb limb;
+		static constexpr size_t LIMBS = Bits / 32;
+
+	private:
+		// Limbs en orden little-endian; siempre los LIMBS, también los ceros
+		limb limbs[LIMBS];
+
+		// ==================== NÚCLEOS DESPLEGADOS ====================
+		// Cada paso trata un limb y llama al siguiente: el compilador ve una
+		// secuencia recta de LIMBS operaciones, sin bucle ni contador
+
+		/**
+		 * @brief r[I..] = a[I..] + b[I..] + carry (r puede ser a o b)
+		 * @return Carry que sale por arriba
+		 */
+		template <size_t I, bool End = (I == LIMBS)>
+		struct addStep
+		{
+			static constexpr limb run(limb* r, const limb* a, const limb* b, limb carry)
+			{
+				uint64_t cur = (uint64_t)a[I] + b[I] + carry;
+				r[I] = (limb)cur;
+				return(addStep<I + 1>::run(r, a, b, (limb)(cur >> 32)));
+			}
+		};
+
+		template <size_t I>
+		struct addStep<I, true>
+		{
+			static constexpr limb run(limb*, const limb*, const limb*, limb carry)
+			{
+				return(carry);
+			}
+		};
+
+		/**
+		 * @brief r[I..] = a[I..] - b[I..] - borrow (r puede ser a o b)
+		 * @return 1 si hubo préstamo por arriba (a < b)
+		 */
+		template <size_t I, bool End = (I == LIMBS)>
+		struct subStep
+		{
+			static constexpr limb run(limb* r, const limb* a, const limb* b, limb borrow)
+			{
+				uint64_t cur = (uint64_t)a[I] - b[I] - borrow;
+				r[I] = (limb)cur;
+				return(subStep<I + 1>::run(r, a, b, (limb)(cur >> 63)));
+			}
+		};
+
+		template <size_t I>
+		struct subStep<I, true>
+		{
+			static constexpr limb run(limb*, const limb*, const limb*, limb borrow)
+			{
+				return(borrow);
+			}
+		};
+
+		/**
+		 * @brief r[I+J..] += a[I] * b[J..] hasta el limb LIMBS - 1; lo que
+		 * pasa de ahí es múltiplo de 2^Bits y se descarta
+		 */
+		template <size_t I, size_t J, bool End = (I + J == LIMBS)>
+		struct mulStep
+		{
+			static constexpr void run(limb* r, const limb* a, const limb* b, limb carry)
+			{
+				// (2^32-1) + (2^32-1)^2 + (2^32-1) = 2^64-1: no desborda
+				uint64_t cur = (uint64_t)a[I] * b[J] + r[I + J] + carry;
+				r[I + J] = (limb)cur;
+				mulStep<I, J + 1>::run(r, a, b, (limb)(cur >> 32));
+			}
+		};
+
+		template <size_t I, size_t J>
+		struct mulStep<I, J, true>
+		{
+			static constexpr void run(limb*, const limb*, const limb*, limb) {}
+		};
+
+		/**
+		 * @brief Producto escolar truncado, una fila por limb de a
+		 * (r debe empezar a 0 y no puede ser a ni b)
+		 */
+		template <size_t I, bool End = (I == LIMBS)>
+		struct mulRow
+		{
+			static constexpr void run(limb* r, const limb* a, const limb* b)
+			{
+				mulStep<I, 0>::run(r, a, b, 0);
+				mulRow<I + 1>::run(r, a, b);
+			}
+		};
+
+		template <size_t I>
+		struct mulRow<I, true>
+		{
+			static constexpr void run(limb*, const limb*, const limb*) {}
+		};
+
+		// ==================== FUNCIONES AUXILIARES ====================
+
+		/**
+		 * @brief Multiplica in-place por un limb
+		 * @return Limb que sale por arriba
+		 */
+		constexpr limb mulSmall(limb m)
+		{
+			uint64_t carry = 0;
+			for(size_t i = 0; i < LIMBS; i++)
+			{
+				uint64_t cur = (uint64_t)this->limbs[i] * m + carry;
+				this->limbs[i] = (limb)cur;
+				carry = cur >> 32;
+			}
+			return((limb)carry);
+		}
+
+		/**
+		 * @brief Divide in-place por un limb (distinto de 0)
+		 * @return Resto
+		 */
+		constexpr limb divSmall(limb d)
+		{
+			uint64_t rem = 0;
+			for(size_t i = LIMBS; i > 0; i--)
+			{
+				uint64_t cur = (rem << 32) | this->limbs[i - 1];
+				this->limbs[i - 1] = (limb)(cur / d);
+				rem = cur % d;
+			}
+			return((limb)rem);
+		}
+
+		/**
+		 * @brief Limbs significativos (0 para el valor 0)
+		 */
+		constexpr size_t usedLimbs() const
+		{
+			size_t n = LIMBS;
+			while(n > 0 && this->limbs[n - 1] == 0)
+				n--;
+			return(n);
+		}
+
+		/**
+		 * @brief Pone el valor a 0
+		 */
+		constexpr void clear()
+		{
+			for(size_t i = 0; i < LIMBS; i++)
+				this->limbs[i] = 0;
+		}
+
+		/**
+		 * @brief Potencia de 10 que cabe en un limb
+		 * @param n Exponente (0 <= n <= 9)
+		 */
+		static constexpr limb smallPow10(size_t n)
+		{
+			limb res = 1;
+			while(n-- > 0)
+				res *= 10;
+			return(res);
+		}
+
+		/**
+		 * @brief Algoritmo D de Knuth para divisores de 2 limbs o más
+		 * @param vn Limbs significativos del divisor (>= 2)
+		 */
+		constexpr void divmodLong(const fixed_bigint& divisor, size_t vn,
+			fixed_bigint& quotient, fixed_bigint& remainder) const
+		{
+			limb u[LIMBS + 1] = {};
+			limb v[LIMBS] = {};
+			size_t un = this->usedLimbs();
+			quotient.clear();
+			// Normaliza: el bit alto del divisor a 1
+			unsigned int s = 0;
+			for(limb top = divisor.limbs[vn - 1]; (top & 0x80000000u) == 0; top <<= 1)
+				s++;
+			for(size_t i = vn; i > 0; i--)
+			{
+				v[i - 1] = divisor.limbs[i - 1] << s;
+				if(s != 0 && i > 1)
+					v[i - 1] |= divisor.limbs[i - 2] >> (32 - s);
+			}
+			u[un] = (s != 0 && un > 0) ? this->limbs[un - 1] >> (32 - s) : 0;
+			for(size_t i = un; i > 0; i--)
+			{
+				u[i - 1] = this->limbs[i - 1] << s;
+				if(s != 0 && i > 1)
+					u[i - 1] |= this->limbs[i - 2] >> (32 - s);
+			}
+			for(size_t j = un - vn + 1; j > 0; j--)
+			{
+				size_t k = j - 1;
+				uint64_t top = ((uint64_t)u[k + vn] << 32) | u[k + vn - 1];
+				uint64_t qhat = top / v[vn - 1];
+				uint64_t rhat = top % v[vn - 1];
+				while(qhat > 0xFFFFFFFFu
+					|| qhat * v[vn - 2] > ((rhat << 32) | u[k + vn - 2]))
+				{
+					qhat--;
+					rhat += v[vn - 1];
+					if(rhat > 0xFFFFFFFFu)
+						break;
+				}
+				// u[k..k+vn] -= qhat * v
+				uint64_t carry = 0;
+				uint64_t borrow = 0;
+				for(size_t i = 0; i < vn; i++)
+				{
+					uint64_t p = qhat * v[i] + carry;
+					carry = p >> 32;
+					uint64_t cur = (uint64_t)u[k + i] - (limb)p - borrow;
+					u[k + i] = (limb)cur;
+					borrow = cur >> 63;
+				}
+				uint64_t cur = (uint64_t)u[k + vn] - carry - borrow;
+				u[k + vn] = (limb)cur;
+				if((cur >> 63) != 0)
+				{
+					// qhat era uno de más: se devuelve un divisor
+					qhat--;
+					uint64_t c = 0;
+					for(size_t i = 0; i < vn; i++)
+					{
+						uint64_t sum = (uint64_t)u[k + i] + v[i] + c;
+						u[k + i] = (limb)sum;
+						c = sum >> 32;
+					}
+					u[k + vn] += (limb)c;
+				}
+				quotient.limbs[k] = (limb)qhat;
+			}
+			remainder.clear();
+			for(size_t i = 0; i < vn; i++)
+			{
+				remainder.limbs[i] = u[i] >> s;
+				if(s != 0)
+					remainder.limbs[i] |= u[i + 1] << (32 - s);
+			}
+		}
+
+	public:
+		// ==================== CONSTRUCTORES ====================
+		/**
+		 * @brief Constructor por defecto
+		 * Inicializa el número con valor 0
+		 */
+		constexpr fixed_bigint() : limbs() {}
+
+		/**
+		 * @brief Constructor con entero sin signo
+		 * @param num Número entero a convertir
+		 */
+		constexpr fixed_bigint(unsigned int num) : limbs()
+		{
+			this->limbs[0] = num;
+		}
+
+		/**
+		 * @brief Constructor desde texto decimal
+		 * @param str Número en base 10, solo dígitos
+		 * @throw std::invalid_argument si str no es un número válido
+		 * @throw std::overflow_error si no cabe en Bits bits
+		 */
+		explicit fixed_bigint(const std::string& str) : limbs()
+		{
+			if(str.empty())
+				throw std::invalid_argument("fixed_bigint: empty string");
+			for(size_t i = 0; i < str.size(); i++)
+			{
+				if(str[i] < '0' || str[i] > '9')
+					throw std::invalid_argument("fixed_bigint: invalid digit in \"" + str + "\"");
+			}
+			// Bloques de hasta 9 dígitos: un multiplica-y-suma por bloque
+			for(size_t pos = 0; pos < str.size(); )
+			{
+				size_t len = std::min((size_t)9, str.size() - pos);
+				limb chunk = 0;
+				for(size_t i = 0; i < len; i++)
+					chunk = chunk * 10 + (limb)(str[pos + i] - '0');
+				pos += len;
+				limb carry = this->mulSmall(smallPow10(len));
+				limb add[LIMBS] = { chunk };
+				carry |= addStep<0>::run(this->limbs, this->limbs, add, 0);
+				if(carry != 0)
+					throw std::overflow_error("fixed_bigint: value too large");
+			}
+		}
+
+		/**
+		 * @brief Conversión explícita desde bigint
+		 * @param value Valor a convertir
+		 * @throw std::overflow_error si no cabe en Bits bits
+		 */
+		explicit fixed_bigint(const bigint& value) : limbs()
+		{
+			if(value.limbs.size() > LIMBS)
+				throw std::overflow_error("fixed_bigint: value too large");
+			for(size_t i = 0; i < value.limbs.size(); i++)
+				this->limbs[i] = value.limbs[i];
+		}
+
+		/**
+		 * @brief Conversión explícita a bigint (siempre exacta)
+		 */
+		explicit operator bigint() const
+		{
+			bigint result;
+			result.limbs.assign(this->limbs, this->limbs + this->usedLimbs());
+			return(result);
+		}
+
+		// ==================== GETTERS ====================
+		/**
+		 * @brief Obtiene la representación string del número
+		 * @return String con el número en base 10
+		 */
+		std::string getStr() const
+		{
+			fixed_bigint rest(*this);
+			std::vector<limb> chunks;
+			while(rest.usedLimbs() != 0)
+				chunks.push_back(rest.divSmall(1000000000u));
+			if(chunks.empty())
+				return("0");
+			std::ostringstream out;
+			out << chunks.back();
+			for(size_t i = chunks.size() - 1; i > 0; i--)
+			{
+				out.width(9);
+				out.fill('0');
+				out << chunks[i - 1];
+			}
+			return(out.str());
+		}
+
+		/**
+		 * @brief Acceso a un limb
+		 * @param i Índice (0 = menos significativo, < LIMBS)
+		 */
+		constexpr limb limbAt(size_t i) const
+		{
+			return(this->limbs[i]);
+		}
+
+		// ==================== OPERADORES ARITMÉTICOS ====================
+		/**
+		 * @brief Operador de suma (módulo 2^Bits)
+		 * @param other Otro número a sumar
+		 * @return Nuevo número con el resultado
+		 */
+		constexpr fixed_bigint operator+(const fixed_bigint& other) const
+		{
+			fixed_bigint result;
+			addStep<0>::run(result.limbs, this->limbs, other.limbs, 0);
+			return(result);
+		}
+
+		/**
+		 * @brief Operador de suma y asignación (módulo 2^Bits)
+		 * @param other Otro número a sumar
+		 * @return Referencia al objeto actual
+		 */
+		constexpr fixed_bigint& operator+=(const fixed_bigint& other)
+		{
+			addStep<0>::run(this->limbs, this->limbs, other.limbs, 0);
+			return(*this);
+		}
+
+		/**
+		 * @brief Operador de resta (módulo 2^Bits: si other es mayor, da la vuelta)
+		 * @param other Otro número a restar
+		 * @return Nuevo número con el resultado
+		 */
+		constexpr fixed_bigint operator-(const fixed_bigint& other) const
+		{
+			fixed_bigint result;
+			subStep<0>::run(result.limbs, this->limbs, other.limbs, 0);
+			return(result);
+		}
+
+		/**
+		 * @brief Operador de resta y asignación (módulo 2^Bits)
+		 * @param other Otro número a restar
+		 * @return Referencia al objeto actual
+		 */
+		constexpr fixed_bigint& operator-=(const fixed_bigint& other)
+		{
+			subStep<0>::run(this->limbs, this->limbs, other.limbs, 0);
+			return(*this);
+		}
+
+		/**
+		 * @brief Operador de multiplicación (módulo 2^Bits)
+		 * Producto escolar desplegado que solo calcula los LIMBS limbs bajos
+		 * @param other Otro número a multiplicar
+		 * @return Nuevo número con el resultado
+		 */
+		constexpr fixed_bigint operator*(const fixed_bigint& other) const
+		{
+			fixed_bigint result;
+			mulRow<0>::run(result.limbs, this->limbs, other.limbs);
+			return(result);
+		}
+
+		/**
+		 * @brief Operador de multiplicación y asignación (módulo 2^Bits)
+		 * @param other Otro número a multiplicar
+		 * @return Referencia al objeto actual
+		 */
+		constexpr fixed_bigint& operator*=(const fixed_bigint& other)
+		{
+			*this = *this * other;
+			return(*this);
+		}
+
+		/**
+		 * @brief División entera con resto en una sola pasada
+		 * Corta para divisores de un limb; si no, algoritmo D de Knuth
+		 * @param divisor Divisor (distinto de 0)
+		 * @param quotient Recibe el cociente
+		 * @param remainder Recibe el resto
+		 * @throw std::domain_error si divisor es 0
+		 */
+		constexpr void divmod(const fixed_bigint& divisor, fixed_bigint& quotient, fixed_bigint& remainder) const
+		{
+			size_t vn = divisor.usedLimbs();
+			if(vn == 0)
+				throw std::domain_error("fixed_bigint: division by zero");
+			if(vn == 1)
+			{
+				fixed_bigint q(*this);
+				limb rem = q.divSmall(divisor.limbs[0]);
+				quotient = q;
+				remainder = fixed_bigint(rem);
+			}
+			else if(this->compare(divisor) < 0)
+			{
+				remainder = *this;
+				quotient = fixed_bigint();
+			}
+			else
+			{
+				fixed_bigint q;
+				fixed_bigint r;
+				this->divmodLong(divisor, vn, q, r);
+				quotient = q;
+				remainder = r;
+			}
+		}
+
+		/**
+		 * @brief Operador de división entera
+		 * @param other Divisor (distinto de 0)
+		 * @return Nuevo número con el cociente
+		 * @throw std::domain_error si other es 0
+		 */
+		constexpr fixed_bigint operator/(const fixed_bigint& other) const
+		{
+			fixed_bigint q;
+			fixed_bigint r;
+			this->divmod(other, q, r);
+			return(q);
+		}
+
+		/**
+		 * @brief Operador de módulo
+		 * @param other Divisor (distinto de 0)
+		 * @return Nuevo número con el resto
+		 * @throw std::domain_error si other es 0
+		 */
+		constexpr fixed_bigint operator%(const fixed_bigint& other) const
+		{
+			fixed_bigint q;
+			fixed_bigint r;
+			this->divmod(other, q, r);
+			return(r);
+		}
+
+		/**
+		 * @brief Operador de división y asignación
+		 * @throw std::domain_error si other es 0
+		 */
+		constexpr fixed_bigint& operator/=(const fixed_bigint& other)
+		{
+			*this = *this / other;
+			return(*this);
+		}
+
+		/**
+		 * @brief Operador de módulo y asignación
+		 * @throw std::domain_error si other es 0
+		 */
+		constexpr fixed_bigint& operator%=(const fixed_bigint& other)
+		{
+			*this = *this % other;
+			return(*this);
+		}
+
+		// ==================== OPERADORES DE INCREMENTO ====================
+		/**
+		 * @brief Incremento prefijo (++x), módulo 2^Bits
+		 * @return Referencia al objeto actual incrementado
+		 */
+		constexpr fixed_bigint& operator++()
+		{
+			for(size_t i = 0; i < LIMBS; i++)
+			{
+				if(++this->limbs[i] != 0)
+					break;
+			}
+			return(*this);
+		}
+
+		/**
+		 * @brief Incremento postfijo (x++)
+		 * @return Copia del objeto antes del incremento
+		 */
+		constexpr fixed_bigint operator++(int)
+		{
+			fixed_bigint temp(*this);
+			++(*this);
+			return(temp);
+		}
+
+		// ==================== DESPLAZAMIENTOS BINARIOS ====================
+		/**
+		 * @brief Desplazamiento binario a la izquierda in-place (por 2^n, módulo 2^Bits)
+		 * @param n Número de bits
+		 * @return Referencia al objeto actual
+		 */
+		constexpr fixed_bigint& shiftLeftBits(size_t n)
+		{
+			if(n >= Bits)
+			{
+				this->clear();
+				return(*this);
+			}
+			size_t whole = n / 32;
+			unsigned int bits = (unsigned int)(n % 32);
+			for(size_t i = LIMBS; i > 0; i--)
+			{
+				size_t dst = i - 1;
+				limb v = (dst >= whole) ? this->limbs[dst - whole] << bits : 0;
+				if(bits != 0 && dst > whole)
+					v |= this->limbs[dst - whole - 1] >> (32 - bits);
+				this->limbs[dst] = v;
+			}
+			return(*this);
+		}
+
+		/**
+		 * @brief Desplazamiento binario a la derecha in-place (entre 2^n)
+		 * @param n Número de bits
+		 * @return Referencia al objeto actual
+		 */
+		constexpr fixed_bigint& shiftRightBits(size_t n)
+		{
+			if(n >= Bits)
+			{
+				this->clear();
+				return(*this);
+			}
+			size_t whole = n / 32;
+			unsigned int bits = (unsigned int)(n % 32);
+			for(size_t dst = 0; dst < LIMBS; dst++)
+			{
+				limb v = (dst + whole < LIMBS) ? this->limbs[dst + whole] >> bits : 0;
+				if(bits != 0 && dst + whole + 1 < LIMBS)
+					v |= this->limbs[dst + whole + 1] << (32 - bits);
+				this->limbs[dst] = v;
+			}
+			return(*this);
+		}
+
+		/**
+		 * @brief Número de bits significativos (0 para el valor 0)
+		 */
+		constexpr size_t bitLength() const
+		{
+			size_t n = this->usedLimbs();
+			if(n == 0)
+				return(0);
+			size_t bits = (n - 1) * 32;
+			for(limb top = this->limbs[n - 1]; top != 0; top >>= 1)
+				bits++;
+			return(bits);
+		}
+
+		/**
+		 * @brief Consulta un bit del valor binario
+		 * @param i Posición del bit (0 = menos significativo)
+		 * @return true si el bit i está a 1
+		 */
+		constexpr bool testBit(size_t i) const
+		{
+			return(i < Bits && ((this->limbs[i / 32] >> (i % 32)) & 1) != 0);
+		}
+
+		// ==================== DESPLAZAMIENTOS DECIMALES ====================
+		/**
+		 * @brief Desplazamiento decimal a la izquierda in-place (por 10^n, módulo 2^Bits)
+		 * 10^n es múltiplo de 2^n, así que con n >= Bits el resultado es 0
+		 * @param n Número de dígitos
+		 * @return Referencia al objeto actual
+		 */
+		constexpr fixed_bigint& shiftLeftDecimal(size_t n)
+		{
+			if(n >= Bits)
+			{
+				this->clear();
+				return(*this);
+			}
+			for(; n >= 9; n -= 9)
+				this->mulSmall(1000000000u);
+			if(n > 0)
+				this->mulSmall(smallPow10(n));
+			return(*this);
+		}
+
+		/**
+		 * @brief Desplazamiento decimal a la derecha in-place (entre 10^n)
+		 * @param n Número de dígitos
+		 * @return Referencia al objeto actual
+		 */
+		constexpr fixed_bigint& shiftRightDecimal(size_t n)
+		{
+			// Un valor de Bits bits tiene menos de Bits dígitos
+			if(n >= Bits)
+			{
+				this->clear();
+				return(*this);
+			}
+			for(; n >= 9; n -= 9)
+			{
+				if(this->usedLimbs() == 0)
+					return(*this);
+				this->divSmall(1000000000u);
+			}
+			if(n > 0)
+				this->divSmall(smallPow10(n));
+			return(*this);
+		}
+
+		// ==================== OPERADORES DE DESPLAZAMIENTO (CON ENTERO) ====================
+		/**
+		 * @brief Desplazamiento a la izquierda (multiplicación por 10^n, módulo 2^Bits)
+		 * @param n Número de posiciones a desplazar
+		 * @return Nuevo número desplazado
+		 */
+		constexpr fixed_bigint operator<<(unsigned int n) const
+		{
+			fixed_bigint result(*this);
+			result.shiftLeftDecimal(n);
+			return(result);
+		}
+
+		/**
+		 * @brief Desplazamiento a la derecha (división por 10^n)
+		 * @param n Número de posiciones a desplazar
+		 * @return Nuevo número desplazado
+		 */
+		constexpr fixed_bigint operator>>(unsigned int n) const
+		{
+			fixed_bigint result(*this);
+			result.shiftRightDecimal(n);
+			return(result);
+		}
+
+		/**
+		 * @brief Desplazamiento a la izquierda y asignación
+		 * @param n Número de posiciones a desplazar
+		 * @return Referencia al objeto actual
+		 */
+		constexpr fixed_bigint& operator<<=(unsigned int n)
+		{
+			return(this->shiftLeftDecimal(n));
+		}
+
+		/**
+		 * @brief Desplazamiento a la derecha y asignación
+		 * @param n Número de posiciones a desplazar
+		 * @return Referencia al objeto actual
+		 */
+		constexpr fixed_bigint& operator>>=(unsigned int n)
+		{
+			return(this->shiftRightDecimal(n));
+		}
+
+		// ==================== OPERADORES DE DESPLAZAMIENTO (CON FIXED_BIGINT) ====================
+		// Un contador de Bits o más da 0 en los dos sentidos, así que
+		// nunca hace falta mirar más allá del limb bajo
+		/**
+		 * @brief Desplazamiento a la izquierda con contador fixed_bigint
+		 * @param other Número que indica las posiciones a desplazar
+		 * @return Nuevo número desplazado
+		 */
+		constexpr fixed_bigint operator<<(const fixed_bigint& other) const
+		{
+			fixed_bigint result(*this);
+			result <<= other;
+			return(result);
+		}
+
+		/**
+		 * @brief Desplazamiento a la derecha con contador fixed_bigint
+		 * @param other Número que indica las posiciones a desplazar
+		 * @return Nuevo número desplazado
+		 */
+		constexpr fixed_bigint operator>>(const fixed_bigint& other) const
+		{
+			fixed_bigint result(*this);
+			result >>= other;
+			return(result);
+		}
+
+		/**
+		 * @brief Desplazamiento a la izquierda y asignación con contador fixed_bigint
+		 * @return Referencia al objeto actual
+		 */
+		constexpr fixed_bigint& operator<<=(const fixed_bigint& other)
+		{
+			return(this->shiftLeftDecimal((other.usedLimbs() > 1) ? Bits : (size_t)other.limbs[0]));
+		}
+
+		/**
+		 * @brief Desplazamiento a la derecha y asignación con contador fixed_bigint
+		 * @return Referencia al objeto actual
+		 */
+		constexpr fixed_bigint& operator>>=(const fixed_bigint& other)
+		{
+			return(this->shiftRightDecimal((other.usedLimbs() > 1) ? Bits : (size_t)other.limbs[0]));
+		}
+
+		// ==================== OPERADORES DE COMPARACIÓN ====================
+		/**
+		 * @brief Comparación de tres vías desde el limb más significativo
+		 * @param other Otro número a comparar
+		 * @return Negativo, 0 o positivo según *this sea menor, igual o mayor
+		 */
+		constexpr int compare(const fixed_bigint& other) const
+		{
+			for(size_t i = LIMBS; i > 0; i--)
+			{
+				if(this->limbs[i - 1] != other.limbs[i - 1])
+					return((this->limbs[i - 1] < other.limbs[i - 1]) ? -1 : 1);
+			}
+			return(0);
+		}
+
+		constexpr bool operator==(const fixed_bigint& other) const { return(this->compare(other) == 0); }
+		constexpr bool operator!=(const fixed_bigint& other) const { return(this->compare(other) != 0); }
+		constexpr bool operator<(const fixed_bigint& other) const { return(this->compare(other) < 0); }
+		constexpr bool operator>(const fixed_bigint& other) const { return(this->compare(other) > 0); }
+		constexpr bool operator<=(const fixed_bigint& other) const { return(this->compare(other) <= 0); }
+		constexpr bool operator>=(const fixed_bigint& other) const { return(this->compare(other) >= 0); }
+};
+
+template <size_t Bits>
+constexpr size_t fixed_bigint<Bits>::LIMBS;
+
+// ==================== OPERADOR DE FLUJO ====================
+/**
+ * @brief Operador de salida para streams
+ * @param output Stream de salida
+ * @param obj Número a imprimir
+ * @return Referencia al stream de salida
+ */
+template <size_t Bits>
+std::ostream& operator<<(std::ostream& output, const fixed_bigint<Bits>& obj)
+{
+	output << obj.getStr();
+	return(output);
+}
+
+#endif
@@ -0,0 +1,501 @@
+#include "montgomery.hpp"
+
+typedef montgomery_context::limb limb;
+
+// Medido con módulos de 1024 a 16384 bits en x86-64, g++ -O2
+size_t montgomery_context::redc_threshold = 192;
+
+// ==================== ACCESO A LOS LIMBS ====================
+
+/**
+ * @brief Copia los limbs de x en un array de n limbs (rellenando con ceros)
+ * @param x Valor (como mucho n limbs)
+ * @param out Destino
+ * @param n Número de limbs
+ */
+void montgomery_context::load(const bigint& x, std::vector<limb>& out, size_t n)
+{
+	out.assign(n, 0);
+	for(size_t i = 0; i < x.limbs.size(); i++)
+		out[i] = x.limbs[i];
+}
+
+/**
+ * @brief Construye un bigint normalizado a partir de un array de limbs
+ * @param x Limbs (little-endian, pueden tener ceros de cabecera)
+ * @return bigint con ese valor
+ */
+bigint montgomery_context::store(const std::vector<limb>& x)
+{
+	bigint result;
+	result.limbs.assign(x.data(), x.data() + x.size());
+	result.trim();
+	return(result);
+}
+
+/**
+ * @brief Se queda con los n limbs bajos de x (x mod 2^(32n))
+ * @param x Valor a truncar in-place
+ * @param n Número de limbs
+ */
+void montgomery_context::truncate(bigint& x, size_t n)
+{
+	if(x.limbs.size() > n)
+	{
+		x.limbs.resize(n);
+		x.trim();
+	}
+}
+
+// ==================== PRODUCTO DE MONTGOMERY ====================
+
+/**
+ * @brief Producto de Montgomery CIOS: r = a·b·R^-1 mod N
+ * Intercala cada fila del producto con su paso de reducción, así el
+ * acumulador nunca pasa de n + 2 limbs. O(n^2) sin divisiones
+ * @param r Destino (n limbs, puede coincidir con a y/o b)
+ * @param a Primer factor (n limbs, < N)
+ * @param b Segundo factor (n limbs, < N)
+ * @param scratch Acumulador reutilizable (se redimensiona a n + 2)
+ */
+void montgomery_context::mulCIOS(limb* r, const limb* a, const limb* b,
+	std::vector<limb>& scratch) const
+{
+	size_t n = this->n;
+	const limb* m = &this->mod[0];
+	scratch.assign(n + 2, 0);
+	limb* t = &scratch[0];
+	for(size_t i = 0; i < n; i++)
+	{
+		// t += a * b[i]
+		uint64_t carry = 0;
+		for(size_t j = 0; j < n; j++)
+		{
+			uint64_t cur = (uint64_t)a[j] * b[i] + t[j] + carry;
+			t[j] = (limb)cur;
+			carry = cur >> 32;
+		}
+		uint64_t top = (uint64_t)t[n] + carry;
+		t[n] = (limb)top;
+		t[n + 1] = (limb)(top >> 32);
+
+		// t = (t + q * N) / 2^32, con q elegido para anular el limb bajo
+		limb q = t[0] * this->nInv;
+		carry = ((uint64_t)q * m[0] + t[0]) >> 32;
+		for(size_t j = 1; j < n; j++)
+		{
+			uint64_t cur = (uint64_t)q * m[j] + t[j] + carry;
+			t[j - 1] = (limb)cur;
+			carry = cur >> 32;
+		}
+		top = (uint64_t)t[n] + carry;
+		t[n - 1] = (limb)top;
+		t[n] = t[n + 1] + (limb)(top >> 32);
+	}
+
+	// t < 2N: como mucho una resta final
+	bool geq = (t[n] != 0);
+	if(!geq)
+	{
+		geq = true;
+		for(size_t j = n; j > 0; j--)
+		{
+			if(t[j - 1] != m[j - 1])
+			{
+				geq = (t[j - 1] > m[j - 1]);
+				break;
+			}
+		}
+	}
+	if(geq)
+	{
+		limb borrow = 0;
+		for(size_t j = 0; j < n; j++)
+		{
+			uint64_t res = (uint64_t)t[j] - m[j] - borrow;
+			t[j] = (limb)res;
+			borrow = (limb)(res >> 63);
+		}
+	}
+	for(size_t j = 0; j < n; j++)
+		r[j] = t[j];
+}
+
+/**
+ * @brief Producto de Montgomery con REDC sobre productos completos
+ * T = a·b, m = (T mod R)·N' mod R, r = (T + m·N) / R. Son tres
+ * multiplicaciones de bigint, que a partir de redc_threshold limbs van por
+ * Karatsuba/Toom-3/NTT y ganan al CIOS cuadrático
+ * @param r Destino (n limbs, puede coincidir con a y/o b)
+ * @param a Primer factor (n limbs, < N)
+ * @param b Segundo factor (n limbs, < N)
+ */
+void montgomery_context::mulREDC(limb* r, const limb* a, const limb* b) const
+{
+	size_t n = this->n;
+	bigint t = store(std::vector<limb>(a, a + n)) * store(std::vector<limb>(b, b + n));
+	bigint m = t;
+	truncate(m, n);
+	m *= this->nPrime;
+	truncate(m, n);
+	t += m * this->modulus;
+	t.shiftRightBits(32 * n);
+	if(t >= this->modulus)
+		t -= this->modulus;
+	for(size_t j = 0; j < n; j++)
+		r[j] = (j < t.limbs.size()) ? t.limbs[j] : 0;
+}
+
+/**
+ * @brief Producto de Montgomery: elige CIOS o REDC según el tamaño de N
+ */
+void montgomery_context::montMul(limb* r, const limb* a, const limb* b,
+	std::vector<limb>& scratch) const
+{
+	if(this->n >= montgomery_context::redc_threshold)
+		this->mulREDC(r, a, b);
+	else
+		this->mulCIOS(r, a, b, scratch);
+}
+
+// ==================== CONSTRUCTORES ====================
+
+/**
+ * @brief Precalcula las constantes de un módulo impar
+ * -N^-1 mod 2^32 sale por Newton (cada paso duplica los bits correctos) y
+ * se eleva a -N^-1 mod R por Hensel solo si se va a usar REDC
+ * @param modulus Módulo impar (N > 1)
+ * @throw std::domain_error si modulus es par o menor que 2
+ */
+montgomery_context::montgomery_context(const bigint& modulus)
+	: modulus(modulus), mod(), n(0), nInv(0), nPrime(), r2(), one()
+{
+	if(!modulus.testBit(0) || modulus.bitLength() < 2)
+		throw std::domain_error("montgomery: modulus must be odd and greater than 1");
+	this->n = modulus.limbs.size();
+	load(modulus, this->mod, this->n);
+
+	// N·N = 1 mod 8 para N impar: 3 bits correctos, 4 pasos -> 48 >= 32
+	limb inv = this->mod[0];
+	for(int i = 0; i < 4; i++)
+		inv *= 2 - this->mod[0] * inv;
+	this->nInv = (limb)0 - inv;
+
+	bigint r = bigint(1).shiftLeftBits(32 * this->n);
+	this->r2 = (bigint(1).shiftLeftBits(64 * this->n)) % modulus;
+	load(r % modulus, this->one, this->n);
+
+	if(this->n >= montgomery_context::redc_threshold)
+	{
+		// Hensel: x = N^-1 mod 2^(32k) -> x·(2 - N·x) mod 2^(64k)
+		bigint x(inv);
+		for(size_t k = 1; k < this->n; )
+		{
+			k = std::min(2 * k, this->n);
+			bigint nx = modulus * x;
+			truncate(nx, k);
+			bigint twoMinus = bigint(1).shiftLeftBits(32 * k + 1);
+			twoMinus += bigint(2);
+			twoMinus -= nx;
+			x *= twoMinus;
+			truncate(x, k);
+		}
+		this->nPrime = r - x;
+	}
+}
+
+/**
+ * @brief Constructor de copia
+ * @param source Contexto a copiar
+ */
+montgomery_context::montgomery_context(const montgomery_context& source)
+	: modulus(source.modulus), mod(source.mod), n(source.n), nInv(source.nInv),
+	nPrime(source.nPrime), r2(source.r2), one(source.one)
+{
+}
+
+/**
+ * @brief Operador de asignación
+ * @param source Contexto a asignar
+ * @return Referencia al objeto actual
+ */
+montgomery_context& montgomery_context::operator=(const montgomery_context& source)
+{
+	if(this != &source)
+	{
+		this->modulus = source.modulus;
+		this->mod = source.mod;
+		this->n = source.n;
+		this->nInv = source.nInv;
+		this->nPrime = source.nPrime;
+		this->r2 = source.r2;
+		this->one = source.one;
+	}
+	return(*this);
+}
+
+/**
+ * @brief Destructor
+ */
+montgomery_context::~montgomery_context()
+{
+}
+
+// ==================== OPERACIONES ====================
+
+/**
+ * @brief Módulo del contexto
+ * @return Referencia a N
+ */
+const bigint& montgomery_context::getModulus() const
+{
+	return(this->modulus);
+}
+
+/**
+ * @brief Pasa un valor a forma de Montgomery: x·R mod N = mont(x, R^2)
+ * @param x Valor (cualquier tamaño; se reduce antes)
+ * @return x·R mod N
+ */
+bigint montgomery_context::toMontgomery(const bigint& x) const
+{
+	std::vector<limb> a, b, scratch;
+	load((x < this->modulus) ? x : x % this->modulus, a, this->n);
+	load(this->r2, b, this->n);
+	this->montMul(&a[0], &a[0], &b[0], scratch);
+	return(store(a));
+}
+
+/**
+ * @brief Vuelve de forma de Montgomery: x·R^-1 mod N = mont(x, 1)
+ * @param x Valor en forma de Montgomery
+ * @return x·R^-1 mod N
+ */
+bigint montgomery_context::fromMontgomery(const bigint& x) const
+{
+	std::vector<limb> a, unit(this->n, 0), scratch;
+	load((x < this->modulus) ? x : x % this->modulus, a, this->n);
+	unit[0] = 1;
+	this->montMul(&a[0], &a[0], &unit[0], scratch);
+	return(store(a));
+}
+
+/**
+ * @brief Producto de Montgomery: a·b·R^-1 mod N
+ * @param a Primer factor (se reduce si no es < N)
+ * @param b Segundo factor (se reduce si no es < N)
+ * @return a·b·R^-1 mod N
+ */
+bigint montgomery_context::multiply(const bigint& a, const bigint& b) const
+{
+	std::vector<limb> x, y, scratch;
+	load((a < this->modulus) ? a : a % this->modulus, x, this->n);
+	load((b < this->modulus) ? b : b % this->modulus, y, this->n);
+	this->montMul(&x[0], &x[0], &y[0], scratch);
+	return(store(x));
+}
+
+/**
+ * @brief Exponenciación modular por ventana deslizante
+ * Precalcula las potencias impares g, g^3, ..., g^(2^k - 1) en forma de
+ * Montgomery y recorre el exponente de arriba abajo: los ceros cuestan un
+ * cuadrado y cada ventana de hasta k bits que acaba en 1 cuesta sus
+ * cuadrados y una sola multiplicación. Todo sobre arrays de n limbs sin
+ * ninguna división en el bucle
+ * @param base Base (cualquier tamaño; se reduce antes)
+ * @param exponent Exponente
+ * @return base^exponent mod N
+ */
+bigint montgomery_context::pow(const bigint& base, const bigint& exponent) const
+{
+	size_t bits = exponent.bitLength();
+	if(bits == 0)
+		return(bigint(1));
+
+	// Tamaño de ventana que minimiza multiplicaciones para cada exponente
+	size_t window = 1;
+	if(bits > 671)
+		window = 6;
+	else if(bits > 239)
+		window = 5;
+	else if(bits > 79)
+		window = 4;
+	else if(bits > 23)
+		window = 3;
+	else if(bits > 6)
+		window = 2;
+
+	std::vector<limb> scratch;
+	std::vector< std::vector<limb> > odd((size_t)1 << (window - 1));
+	load(this->toMontgomery(base), odd[0], this->n);
+	if(odd.size() > 1)
+	{
+		std::vector<limb> square(this->n);
+		this->montMul(&square[0], &odd[0][0], &odd[0][0], scratch);
+		for(size_t i = 1; i < odd.size(); i++)
+		{
+			odd[i].resize(this->n);
+			this->montMul(&odd[i][0], &odd[i - 1][0], &square[0], scratch);
+		}
+	}
+
+	std::vector<limb> acc(this->one);
+	bool started = false;
+	size_t i = bits;
+	while(i > 0)
+	{
+		if(!exponent.testBit(i - 1))
+		{
+			if(started)
+				this->montMul(&acc[0], &acc[0], &acc[0], scratch);
+			i--;
+			continue;
+		}
+		// Ventana [low, i - 1] de como mucho 'window' bits que acaba en 1
+		size_t low = (i >= window) ? i - window : 0;
+		while(!exponent.testBit(low))
+			low++;
+		size_t value = 0;
+		for(size_t j = i; j > low; j--)
+			value = (value << 1) | (exponent.testBit(j - 1) ? 1 : 0);
+		if(started)
+		{
+			for(size_t j = low; j < i; j++)
+				this->montMul(&acc[0], &acc[0], &acc[0], scratch);
+			this->montMul(&acc[0], &acc[0], &odd[value >> 1][0], scratch);
+		}
+		else
+		{
+			acc = odd[value >> 1];
+			started = true;
+		}
+		i = low;
+	}
+
+	std::vector<limb> unit(this->n, 0);
+	unit[0] = 1;
+	this->montMul(&acc[0], &acc[0], &unit[0], scratch);
+	return(store(acc));
+}
+
+// ==================== EXPONENCIACIÓN MODULAR ====================
+
+/**
+ * @brief Se queda con los bits bajos de x (x mod 2^bits) sin dividir
+ * @param x Valor a truncar in-place
+ * @param bits Número de bits que se conservan
+ */
+static void keepLowBits(bigint& x, size_t bits)
+{
+	if(x.bitLength() <= bits)
+		return;
+	bigint high(x);
+	high.shiftRightBits(bits);
+	high.shiftLeftBits(bits);
+	x -= high;
+}
+
+/**
+ * @brief base^exponent mod 2^bits: cuadrados y multiplicaciones truncando
+ * cada producto a sus bits bajos
+ * @param base Base
+ * @param exponent Exponente
+ * @param bits k del módulo 2^k (al menos 1)
+ * @return base^exponent mod 2^bits
+ */
+static bigint powLowBits(const bigint& base, const bigint& exponent, size_t bits)
+{
+	bigint b(base);
+	keepLowBits(b, bits);
+	bigint result(1);
+	for(size_t i = exponent.bitLength(); i > 0; i--)
+	{
+		result *= result;
+		keepLowBits(result, bits);
+		if(exponent.testBit(i - 1))
+		{
+			result *= b;
+			keepLowBits(result, bits);
+		}
+		if(result == bigint())
+			break;  // Con base par las potencias acaban en 0 mod 2^bits
+	}
+	keepLowBits(result, bits);
+	return(result);
+}
+
+/**
+ * @brief Inverso de un impar módulo 2^bits por Newton
+ * m·m = 1 mod 8 da 3 bits correctos y cada paso x·(2 - m·x) los duplica
+ * @param m Valor impar
+ * @param bits k del módulo 2^k
+ * @return m^-1 mod 2^bits
+ */
+static bigint inverseLowBits(const bigint& m, size_t bits)
+{
+	bigint x(m);
+	keepLowBits(x, 3);
+	for(size_t done = 3; done < bits; )
+	{
+		done = std::min(2 * done, bits);
+		// 2 - m·x mod 2^done, sin pasar por negativos
+		bigint twoMinus = bigint(1).shiftLeftBits(done);
+		twoMinus += bigint(2);
+		bigint mx = m * x;
+		keepLowBits(mx, done);
+		twoMinus -= mx;
+		x *= twoMinus;
+		keepLowBits(x, done);
+	}
+	keepLowBits(x, bits);
+	return(x);
+}
+
+/**
+ * @brief base^exponent mod modulus
+ * Con módulo impar usa un montgomery_context de un solo uso (para muchas
+ * exponenciaciones con el mismo módulo conviene guardar el contexto). Con
+ * módulo par lo separa en modulus = 2^k·m con m impar: Montgomery da el
+ * resultado mod m, cuadrados truncados a k bits el resultado mod 2^k, y el
+ * teorema chino del resto los combina con m^-1 mod 2^k. No hay ninguna
+ * división por el módulo
+ * @param base Base
+ * @param exponent Exponente
+ * @param modulus Módulo (distinto de 0)
+ * @return base^exponent mod modulus
+ * @throw std::domain_error si modulus es 0
+ */
+bigint powmod(const bigint& base, const bigint& exponent, const bigint& modulus)
+{
+	if(modulus == bigint())
+		throw std::domain_error("bigint: division by zero");
+	if(modulus == bigint(1))
+		return(bigint());
+	if(modulus.testBit(0))
+		return(montgomery_context(modulus).pow(base, exponent));
+
+	size_t k = 0;
+	while(!modulus.testBit(k))
+		k++;
+	bigint odd(modulus);
+	odd.shiftRightBits(k);
+
+	bigint low = powLowBits(base, exponent, k);
+	if(odd == bigint(1))
+		return(low);
+	bigint high = montgomery_context(odd).pow(base, exponent);
+
+	// x = high + odd·t con t = (low - high)·odd^-1 mod 2^k, así x = high
+	// mod odd, x = low mod 2^k y x < odd·2^k
+	bigint highLow(high);
+	keepLowBits(highLow, k);
+	bigint t(low);
+	if(t < highLow)
+		t += bigint(1).shiftLeftBits(k);
+	t -= highLow;
+	t *= inverseLowBits(odd, k);
+	keepLowBits(t, k);
+	t *= odd;
+	t += high;
+	return(t);
+}
@@ -0,0 +1,130 @@
+#ifndef MONTGOMERY
+#define MONTGOMERY
+
+#include "bigint.hpp"
+
+/**
+ * @file montgomery.hpp
+ * @brief Aritmética de Montgomery y exponenciación modular sobre bigint
+ *
+ * Un montgomery_context precalcula todo lo que depende del módulo
+ * (-N^-1 mod 2^32, R^2 mod N, ...) para reutilizarlo en muchas
+ * exponenciaciones contra el mismo módulo:
+ *
+ *     montgomery_context ctx(n);       // una vez por módulo (impar)
+ *     bigint a = ctx.pow(x, e);        // x^e mod n, sin divisiones en el bucle
+ *     bigint b = powmod(x, e, n);      // atajo de un solo uso
+ *
+ * Con R = 2^(32·k), siendo k los limbs del módulo, los valores se guardan
+ * como x·R mod N y el producto se reduce con REDC (solo multiplicaciones,
+ * sumas y desplazamientos de limbs enteros).
+ */
+class montgomery_context
+{
+	public:
+		typedef bigint::limb limb;
+
+	private:
+		bigint modulus;              // N (impar)
+		std::vector<limb> mod;       // Limbs de N
+		size_t n;                    // Número de limbs de N
+		limb nInv;                   // -N^-1 mod 2^32 (CIOS)
+		bigint nPrime;               // -N^-1 mod R (REDC con productos rápidos)
+		bigint r2;                   // R^2 mod N (para entrar en Montgomery)
+		std::vector<limb> one;       // R mod N (el 1 en Montgomery)
+
+		// Acceso a los limbs de bigint (montgomery_context es friend)
+		static void load(const bigint& x, std::vector<limb>& out, size_t n);
+		static bigint store(const std::vector<limb>& x);
+		static void truncate(bigint& x, size_t n);
+		static size_t bitLength(const bigint& x);
+		static bool bit(const bigint& x, size_t i);
+
+		void mulCIOS(limb* r, const limb* a, const limb* b, std::vector<limb>& scratch) const;
+		void mulREDC(limb* r, const limb* a, const limb* b) const;
+		void montMul(limb* r, const limb* a, const limb* b, std::vector<limb>& scratch) const;
+
+	public:
+		// A partir de este tamaño del módulo (en limbs) REDC usa los productos
+		// rápidos de bigint en lugar del CIOS cuadrático
+		static size_t redc_threshold;
+
+		// ==================== CONSTRUCTORES ====================
+		/**
+		 * @brief Precalcula las constantes de un módulo
+		 * @param modulus Módulo impar (N > 1)
+		 * @throw std::domain_error si modulus es par o menor que 2
+		 */
+		explicit montgomery_context(const bigint& modulus);
+
+		/**
+		 * @brief Constructor de copia
+		 * @param source Contexto a copiar
+		 */
+		montgomery_context(const montgomery_context& source);
+
+		/**
+		 * @brief Operador de asignación
+		 * @param source Contexto a asignar
+		 * @return Referencia al objeto actual
+		 */
+		montgomery_context& operator=(const montgomery_context& source);
+
+		/**
+		 * @brief Destructor
+		 */
+		~montgomery_context();
+
+		// ==================== OPERACIONES ====================
+		/**
+		 * @brief Módulo del contexto
+		 * @return Referencia a N
+		 */
+		const bigint& getModulus() const;
+
+		/**
+		 * @brief Pasa un valor a forma de Montgomery: x·R mod N
+		 * @param x Valor (cualquier tamaño; se reduce antes)
+		 * @return x·R mod N
+		 */
+		bigint toMontgomery(const bigint& x) const;
+
+		/**
+		 * @brief Vuelve de forma de Montgomery: x·R^-1 mod N
+		 * @param x Valor en forma de Montgomery (< N)
+		 * @return x·R^-1 mod N
+		 */
+		bigint fromMontgomery(const bigint& x) const;
+
+		/**
+		 * @brief Producto de Montgomery: a·b·R^-1 mod N
+		 * @param a Primer factor (< N)
+		 * @param b Segundo factor (< N)
+		 * @return a·b·R^-1 mod N
+		 */
+		bigint multiply(const bigint& a, const bigint& b) const;
+
+		/**
+		 * @brief Exponenciación modular por ventana deslizante
+		 * @param base Base (cualquier tamaño; se reduce antes)
+		 * @param exponent Exponente
+		 * @return base^exponent mod N
+		 */
+		bigint pow(const bigint& base, const bigint& exponent) const;
+};
+
+// ==================== EXPONENCIACIÓN MODULAR ====================
+/**
+ * @brief base^exponent mod modulus
+ * Con módulo impar usa un montgomery_context de un solo uso; con módulo par
+ * 2^k·m combina por el teorema chino del resto Montgomery sobre m y
+ * cuadrados truncados a k bits, sin divisiones
+ * @param base Base
+ * @param exponent Exponente
+ * @param modulus Módulo (distinto de 0)
+ * @return base^exponent mod modulus
+ * @throw std::domain_error si modulus es 0
+ */
+bigint powmod(const bigint& base, const bigint& exponent, const bigint& modulus);
+
+#endif
@@ -0,0 +1,357 @@
+#include "signed_bigint.hpp"
+
+// ==================== CONSTRUCTORES ====================
+
+/**
+ * @brief Constructor por defecto
+ * Inicializa con valor 0
+ */
+signed_bigint::signed_bigint() : magnitude(), negative(false)
+{
+}
+
+/**
+ * @brief Constructor con entero con signo
+ * La magnitud se calcula en unsigned para que INT_MIN no desborde
+ * @param value Valor inicial
+ */
+signed_bigint::signed_bigint(int value)
+	: magnitude(value < 0 ? 0u - (unsigned int)value : (unsigned int)value),
+	negative(value < 0)
+{
+}
+
+/**
+ * @brief Constructor desde una magnitud y un signo
+ * @param magnitude Valor absoluto
+ * @param negative true para un valor negativo (se ignora si es 0)
+ */
+signed_bigint::signed_bigint(const bigint& magnitude, bool negative)
+	: magnitude(magnitude), negative(negative && magnitude != bigint())
+{
+}
+
+/**
+ * @brief Constructor desde texto decimal con signo opcional
+ * @param str Dígitos precedidos opcionalmente de '-' o '+'
+ * @throw std::invalid_argument si el texto no es un número válido
+ */
+signed_bigint::signed_bigint(const std::string& str) : magnitude(), negative(false)
+{
+	bool minus = !str.empty() && str[0] == '-';
+	bool sign = minus || (!str.empty() && str[0] == '+');
+	this->magnitude = bigint(sign ? str.substr(1) : str);
+	this->negative = minus && this->magnitude != bigint();
+}
+
+/**
+ * @brief Constructor de copia
+ * @param source Objeto signed_bigint a copiar
+ */
+signed_bigint::signed_bigint(const signed_bigint& source)
+	: magnitude(source.magnitude), negative(source.negative)
+{
+}
+
+#ifdef BIGINT_HAS_MOVE
+/**
+ * @brief Constructor de movimiento
+ * @param source Objeto signed_bigint temporal (queda a 0)
+ */
+signed_bigint::signed_bigint(signed_bigint&& source) noexcept
+	: magnitude(std::move(source.magnitude)), negative(source.negative)
+{
+	source.negative = false;
+}
+#endif
+
+// ==================== OPERADORES DE ASIGNACIÓN ====================
+
+/**
+ * @brief Operador de asignación
+ * @param source Objeto signed_bigint a asignar
+ * @return Referencia al objeto actual
+ */
+signed_bigint& signed_bigint::operator=(const signed_bigint& source)
+{
+	if(this != &source)
+	{
+		this->magnitude = source.magnitude;
+		this->negative = source.negative;
+	}
+	return(*this);
+}
+
+#ifdef BIGINT_HAS_MOVE
+/**
+ * @brief Operador de asignación por movimiento
+ * @param source Objeto signed_bigint temporal (queda a 0)
+ * @return Referencia al objeto actual
+ */
+signed_bigint& signed_bigint::operator=(signed_bigint&& source) noexcept
+{
+	if(this != &source)
+	{
+		this->magnitude = std::move(source.magnitude);
+		this->negative = source.negative;
+		source.negative = false;
+	}
+	return(*this);
+}
+#endif
+
+// ==================== ACCESO ====================
+
+/**
+ * @brief Valor en texto decimal
+ * @return String con el número ('-' delante si es negativo)
+ */
+std::string signed_bigint::getStr() const
+{
+	if(this->negative)
+		return("-" + this->magnitude.getStr());
+	return(this->magnitude.getStr());
+}
+
+/**
+ * @brief Valor absoluto
+ * @return Referencia a la magnitud
+ */
+const bigint& signed_bigint::abs() const
+{
+	return(this->magnitude);
+}
+
+/**
+ * @brief Indica si el valor es negativo
+ * @return true si es < 0
+ */
+bool signed_bigint::isNegative() const
+{
+	return(this->negative);
+}
+
+// ==================== SUMA CON SIGNO ====================
+
+/**
+ * @brief Suma in-place de un valor dado como magnitud y signo
+ * Con el mismo signo suma magnitudes; con signos distintos resta la menor
+ * de la mayor sin copias: -= si la propia es mayor, y subtractFrom (resta
+ * invertida) si no, quedándose con el signo del otro
+ * @param otherMagnitude Magnitud del otro operando (puede ser la propia)
+ * @param otherNegative Signo del otro operando
+ */
+void signed_bigint::addSigned(const bigint& otherMagnitude, bool otherNegative)
+{
+	if(this->negative == otherNegative)
+	{
+		this->magnitude += otherMagnitude;
+		return;
+	}
+	if(this->magnitude.compare(otherMagnitude) >= 0)
+		this->magnitude -= otherMagnitude;
+	else
+	{
+		this->magnitude.subtractFrom(otherMagnitude);
+		this->negative = otherNegative;
+	}
+	if(this->magnitude == bigint())
+		this->negative = false;
+}
+
+// ==================== OPERADORES ARITMÉTICOS ====================
+
+/**
+ * @brief Menos unario
+ * @return Nuevo signed_bigint con el signo cambiado (0 sigue siendo 0)
+ */
+signed_bigint signed_bigint::operator-() const
+{
+	return(signed_bigint(this->magnitude, !this->negative));
+}
+
+/**
+ * @brief Operador de suma
+ * @param other Otro signed_bigint a sumar
+ * @return Nuevo signed_bigint con el resultado
+ */
+signed_bigint signed_bigint::operator+(const signed_bigint& other) const
+{
+	signed_bigint temp(*this);
+	temp += other;
+	return(temp);
+}
+
+/**
+ * @brief Operador de suma y asignación
+ * @param other Otro signed_bigint a sumar (puede ser *this)
+ * @return Referencia al objeto actual
+ */
+signed_bigint& signed_bigint::operator+=(const signed_bigint& other)
+{
+	this->addSigned(other.magnitude, other.negative);
+	return(*this);
+}
+
+/**
+ * @brief Operador de resta
+ * @param other Sustraendo
+ * @return Nuevo signed_bigint con el resultado
+ */
+signed_bigint signed_bigint::operator-(const signed_bigint& other) const
+{
+	signed_bigint temp(*this);
+	temp -= other;
+	return(temp);
+}
+
+/**
+ * @brief Operador de resta y asignación
+ * Suma del opuesto, sin construirlo: solo se invierte el signo del otro
+ * @param other Sustraendo (puede ser *this)
+ * @return Referencia al objeto actual
+ */
+signed_bigint& signed_bigint::operator-=(const signed_bigint& other)
+{
+	this->addSigned(other.magnitude, !other.negative);
+	return(*this);
+}
+
+/**
+ * @brief Operador de multiplicación
+ * @param other Otro signed_bigint a multiplicar
+ * @return Nuevo signed_bigint con el resultado
+ */
+signed_bigint signed_bigint::operator*(const signed_bigint& other) const
+{
+	return(signed_bigint(this->magnitude * other.magnitude,
+		this->negative != other.negative));
+}
+
+/**
+ * @brief Operador de multiplicación y asignación
+ * @param other Otro signed_bigint a multiplicar (puede ser *this)
+ * @return Referencia al objeto actual
+ */
+signed_bigint& signed_bigint::operator*=(const signed_bigint& other)
+{
+	bool resultNegative = this->negative != other.negative;
+	this->magnitude *= other.magnitude;
+	this->negative = resultNegative && this->magnitude != bigint();
+	return(*this);
+}
+
+// ==================== OPERADORES DE INCREMENTO ====================
+
+/**
+ * @brief Operador de pre-incremento
+ * @return Referencia al objeto incrementado
+ */
+signed_bigint& signed_bigint::operator++()
+{
+	if(this->negative)
+		this->addSigned(bigint(1), false);
+	else
+		++this->magnitude;
+	return(*this);
+}
+
+/**
+ * @brief Operador de post-incremento
+ * @return Copia del objeto antes del incremento
+ */
+signed_bigint signed_bigint::operator++(int)
+{
+	signed_bigint temp(*this);
+	++(*this);
+	return(temp);
+}
+
+/**
+ * @brief Operador de pre-decremento
+ * En negativo (o en 0) crece la magnitud con el ++ O(1) amortizado de bigint
+ * @return Referencia al objeto decrementado
+ */
+signed_bigint& signed_bigint::operator--()
+{
+	if(this->negative || this->magnitude == bigint())
+	{
+		++this->magnitude;
+		this->negative = true;
+	}
+	else
+		this->addSigned(bigint(1), true);
+	return(*this);
+}
+
+/**
+ * @brief Operador de post-decremento
+ * @return Copia del objeto antes del decremento
+ */
+signed_bigint signed_bigint::operator--(int)
+{
+	signed_bigint temp(*this);
+	--(*this);
+	return(temp);
+}
+
+// ==================== OPERADORES DE COMPARACIÓN ====================
+
+/**
+ * @brief Comparación de tres vías
+ * Con signos distintos decide el signo; con el mismo, la magnitud (al
+ * revés si ambos son negativos)
+ * @param other Otro signed_bigint a comparar
+ * @return Negativo, 0 o positivo según *this sea menor, igual o mayor
+ */
+int signed_bigint::compare(const signed_bigint& other) const
+{
+	if(this->negative != other.negative)
+		return(this->negative ? -1 : 1);
+	int cmp = this->magnitude.compare(other.magnitude);
+	return(this->negative ? -cmp : cmp);
+}
+
+bool signed_bigint::operator==(const signed_bigint& other) const
+{
+	return(this->compare(other) == 0);
+}
+
+bool signed_bigint::operator!=(const signed_bigint& other) const
+{
+	return(this->compare(other) != 0);
+}
+
+bool signed_bigint::operator<(const signed_bigint& other) const
+{
+	return(this->compare(other) < 0);
+}
+
+bool signed_bigint::operator>(const signed_bigint& other) const
+{
+	return(this->compare(other) > 0);
+}
+
+bool signed_bigint::operator<=(const signed_bigint& other) const
+{
+	return(this->compare(other) <= 0);
+}
+
+bool signed_bigint::operator>=(const signed_bigint& other) const
+{
+	return(this->compare(other) >= 0);
+}
+
+// ==================== OPERADOR DE FLUJO ====================
+
+/**
+ * @brief Operador de salida para streams
+ * @param output Stream de salida
+ * @param obj Objeto signed_bigint a imprimir
+ * @return Referencia al stream
+ */
+std::ostream& operator<<(std::ostream& output, const signed_bigint& obj)
+{
+	output << obj.getStr();
+	return(output);
+}
@@ -0,0 +1,198 @@
+#ifndef SIGNED_BIGINT
+#define SIGNED_BIGINT
+
+#include "bigint.hpp"
+
+/**
+ * @file signed_bigint.hpp
+ * @brief Entero de precisión arbitraria con signo
+ *
+ * Signo-magnitud: la magnitud es un bigint (mismos limbs, mismos núcleos)
+ * y el signo un bool aparte. El 0 siempre es positivo, así que no existe
+ * "-0" y la igualdad sigue siendo comparar signo y limbs.
+ */
+class signed_bigint
+{
+	private:
+		bigint magnitude;   // Valor absoluto
+		bool negative;      // true solo si el valor es < 0
+
+		void addSigned(const bigint& otherMagnitude, bool otherNegative);
+
+	public:
+		// ==================== CONSTRUCTORES ====================
+		/**
+		 * @brief Constructor por defecto (valor 0)
+		 */
+		signed_bigint();
+
+		/**
+		 * @brief Constructor con entero con signo
+		 * @param value Valor inicial (INT_MIN incluido)
+		 */
+		signed_bigint(int value);
+
+		/**
+		 * @brief Constructor desde una magnitud y un signo
+		 * @param magnitude Valor absoluto
+		 * @param negative true para un valor negativo (se ignora si es 0)
+		 */
+		signed_bigint(const bigint& magnitude, bool negative = false);
+
+		/**
+		 * @brief Constructor desde texto decimal con signo opcional
+		 * @param str Dígitos precedidos opcionalmente de '-' o '+'
+		 * @throw std::invalid_argument si el texto no es un número válido
+		 */
+		explicit signed_bigint(const std::string& str);
+
+		/**
+		 * @brief Constructor de copia
+		 * @param source Objeto signed_bigint a copiar
+		 */
+		signed_bigint(const signed_bigint& source);
+
+#ifdef BIGINT_HAS_MOVE
+		/**
+		 * @brief Constructor de movimiento (reutiliza los limbs de source)
+		 * @param source Objeto signed_bigint temporal
+		 */
+		signed_bigint(signed_bigint&& source) noexcept;
+#endif
+
+		// ==================== OPERADORES DE ASIGNACIÓN ====================
+		/**
+		 * @brief Operador de asignación
+		 * @param source Objeto signed_bigint a asignar
+		 * @return Referencia al objeto actual
+		 */
+		signed_bigint& operator=(const signed_bigint& source);
+
+#ifdef BIGINT_HAS_MOVE
+		/**
+		 * @brief Operador de asignación por movimiento
+		 * @param source Objeto signed_bigint temporal
+		 * @return Referencia al objeto actual
+		 */
+		signed_bigint& operator=(signed_bigint&& source) noexcept;
+#endif
+
+		// ==================== ACCESO ====================
+		/**
+		 * @brief Valor en texto decimal (con '-' si es negativo)
+		 * @return String con el número
+		 */
+		std::string getStr() const;
+
+		/**
+		 * @brief Valor absoluto
+		 * @return Referencia a la magnitud
+		 */
+		const bigint& abs() const;
+
+		/**
+		 * @brief Indica si el valor es negativo
+		 * @return true si es < 0
+		 */
+		bool isNegative() const;
+
+		// ==================== OPERADORES ARITMÉTICOS ====================
+		/**
+		 * @brief Menos unario
+		 * @return Nuevo signed_bigint con el signo cambiado
+		 */
+		signed_bigint operator-() const;
+
+		/**
+		 * @brief Operador de suma
+		 * @param other Otro signed_bigint a sumar
+		 * @return Nuevo signed_bigint con el resultado
+		 */
+		signed_bigint operator+(const signed_bigint& other) const;
+
+		/**
+		 * @brief Operador de suma y asignación
+		 * @param other Otro signed_bigint a sumar
+		 * @return Referencia al objeto actual
+		 */
+		signed_bigint& operator+=(const signed_bigint& other);
+
+		/**
+		 * @brief Operador de resta
+		 * @param other Sustraendo
+		 * @return Nuevo signed_bigint con el resultado
+		 */
+		signed_bigint operator-(const signed_bigint& other) const;
+
+		/**
+		 * @brief Operador de resta y asignación
+		 * @param other Sustraendo
+		 * @return Referencia al objeto actual
+		 */
+		signed_bigint& operator-=(const signed_bigint& other);
+
+		/**
+		 * @brief Operador de multiplicación
+		 * @param other Otro signed_bigint a multiplicar
+		 * @return Nuevo signed_bigint con el resultado
+		 */
+		signed_bigint operator*(const signed_bigint& other) const;
+
+		/**
+		 * @brief Operador de multiplicación y asignación
+		 * @param other Otro signed_bigint a multiplicar
+		 * @return Referencia al objeto actual
+		 */
+		signed_bigint& operator*=(const signed_bigint& other);
+
+		// ==================== OPERADORES DE INCREMENTO ====================
+		/**
+		 * @brief Operador de pre-incremento
+		 * @return Referencia al objeto incrementado
+		 */
+		signed_bigint& operator++();
+
+		/**
+		 * @brief Operador de post-incremento
+		 * @return Copia del objeto antes del incremento
+		 */
+		signed_bigint operator++(int);
+
+		/**
+		 * @brief Operador de pre-decremento
+		 * @return Referencia al objeto decrementado
+		 */
+		signed_bigint& operator--();
+
+		/**
+		 * @brief Operador de post-decremento
+		 * @return Copia del objeto antes del decremento
+		 */
+		signed_bigint operator--(int);
+
+		// ==================== OPERADORES DE COMPARACIÓN ====================
+		/**
+		 * @brief Comparación de tres vías
+		 * @param other Otro signed_bigint a comparar
+		 * @return Negativo, 0 o positivo según *this sea menor, igual o mayor
+		 */
+		int compare(const signed_bigint& other) const;
+
+		bool operator==(const signed_bigint& other) const;
+		bool operator!=(const signed_bigint& other) const;
+		bool operator<(const signed_bigint& other) const;
+		bool operator>(const signed_bigint& other) const;
+		bool operator<=(const signed_bigint& other) const;
+		bool operator>=(const signed_bigint& other) const;
+};
+
+// ==================== OPERADOR DE FLUJO ====================
+/**
+ * @brief Operador de salida para streams
+ * @param output Stream de salida
+ * @param obj Objeto signed_bigint a imprimir
+ * @return Referencia al stream
+ */
+std::ostream& operator<<(std::ostream& output, const signed_bigint& obj);
+
+#endif
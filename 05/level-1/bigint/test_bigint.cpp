@@ -0,0 +1,1031 @@
+#include "bigint.hpp"
+#include "bigint_expr.hpp"
+#include "test_util.hpp"
+#include <cstdio>
+#include <list>
+#include <sstream>
+#ifdef BIGINT_HAS_STD_HASH
+# include <unordered_set>
+#endif
+#if __cplusplus >= 201402L
+# include "fixed_bigint.hpp"
+#endif
+
+/**
+ * @file test_bigint.cpp
+ * @brief Comprobaciones de las extensiones de bigint contra su forma directa
+ *
+ * Cada sección compara una operación con otra forma más simple de obtener
+ * el mismo resultado:
+ *   - división corta, Knuth D y Newton frente a q * b + r == a, r < b
+ *   - operadores sobre temporales (C++11) e in-place frente a los de copias
+ *   - sumas fusionadas con lazy() frente a '+' encadenados
+ *   - núcleos AVX2 de suma y resta frente a los escalares
+ *   - compare() frente a la comparación de los textos
+ *   - desplazamientos frente a multiplicar y dividir por 2^n y 10^n
+ *   - operaciones dentro de scratch_scope frente a las mismas sin scope
+ *   - bigint::sum y parallelSum frente a un bucle de +=
+ *   - bigint::parser con trozos de tamaños raros y operator>> frente a
+ *     bigint(string)
+ *   - isqrt/iroot frente a la definición r^n <= x < (r + 1)^n
+ *   - fixed_bigint<256> (C++14) frente a bigint módulo 2^256
+ *   - hash() y std::hash<bigint> de un mismo valor construido de varias formas
+ *
+ * Compilar y ejecutar (código 1 si algo falla):
+ *     c++ -std=c++14 -O2 -pthread test_bigint.cpp bigint.cpp -o test_bigint
+ *     ./test_bigint
+ *
+ * Con un estándar anterior las secciones que lo necesitan se saltan.
+ */
+
+// ==================== VALORES ====================
+
+/**
+ * @brief Valores de prueba: del 0 a miles de dígitos, dentro y fuera del
+ * buffer interno de 4 limbs
+ */
+static std::vector<bigint> sampleValues()
+{
+	static const size_t DIGITS[] = { 1, 9, 10, 20, 38, 39, 40, 100, 1000, 5000 };
+	std::vector<bigint> values;
+	uint32_t seed = 2024;
+	values.push_back(bigint());
+	for(size_t i = 0; i < sizeof(DIGITS) / sizeof(DIGITS[0]); i++)
+	{
+		values.push_back(randomDecimal(DIGITS[i], seed));
+		values.push_back(randomDecimal(DIGITS[i], seed));
+	}
+	return(values);
+}
+
+// ==================== DIVISIÓN ====================
+
+/**
+ * @brief q * b + r == a y r < b, y '/', '%' y divmod dan lo mismo
+ */
+static void checkDivision(const bigint& a, const bigint& b, const char* what)
+{
+	bigint q;
+	bigint r;
+	a.divmod(b, q, r);
+	expect(q * b + r == a && r < b, what);
+	expect(a / b == q && a % b == r, "'/' y '%' == divmod");
+}
+
+/**
+ * @brief Divisores de n limbs de los tres tipos que interesan a Knuth D y
+ * a Newton: aleatorio, limb alto 0x80000000 (ya normalizado, qhat se pasa
+ * a menudo) y todo unos
+ */
+static std::vector<bigint> divisorsOf(size_t n, uint32_t seed)
+{
+	std::vector<bigint> divisors;
+	divisors.push_back(randomLimbs(n, seed));
+	bigint top(0x80000000u);
+	if(n > 1)
+		top = top * limbPower(n - 1) + randomLimbs(n - 1, seed + 1);
+	divisors.push_back(top);
+	divisors.push_back(allOnes(n));
+	return(divisors);
+}
+
+/**
+ * @brief Dividendos de m limbs contra cada divisor: aleatorio, todo unos, y
+ * múltiplos exactos del divisor con y sin el resto máximo
+ */
+static void checkDivisors(size_t m, const std::vector<bigint>& divisors, uint32_t seed, const char* what)
+{
+	bigint a = randomLimbs(m, seed);
+	bigint ones = allOnes(m);
+	for(size_t i = 0; i < divisors.size(); i++)
+	{
+		const bigint& b = divisors[i];
+		checkDivision(a, b, what);
+		checkDivision(ones, b, what);
+		bigint multiple = (a / b) * b;
+		checkDivision(multiple, b, what);
+		checkDivision(multiple + b - bigint(1), b, what);
+	}
+}
+
+/**
+ * @brief División corta (un limb), Knuth D y recíproco de Newton (por
+ * encima de newton_threshold, y bajándolo para que los tamaños pequeños
+ * pasen también por sus bucles de corrección)
+ */
+static void testDivision(const std::vector<bigint>& values)
+{
+	for(size_t i = 0; i < values.size(); i++)
+		for(size_t j = 0; j < values.size(); j++)
+			if(values[j] != bigint())
+				checkDivision(values[i], values[j], "valores de prueba");
+
+	static const unsigned int SHORT[] = { 1, 2, 10, 1000000007u, 0x80000000u, 0xFFFFFFFFu };
+	for(size_t d = 0; d < sizeof(SHORT) / sizeof(SHORT[0]); d++)
+	{
+		std::vector<bigint> divisor(1, bigint(SHORT[d]));
+		for(size_t m = 1; m < 40; m += 6)
+			checkDivisors(m, divisor, (uint32_t)(d + m), "división corta");
+	}
+
+	static const size_t KNUTH[] = { 2, 3, 4, 5, 8, 33, 100 };
+	for(size_t k = 0; k < sizeof(KNUTH) / sizeof(KNUTH[0]); k++)
+	{
+		size_t n = KNUTH[k];
+		std::vector<bigint> divisors = divisorsOf(n, (uint32_t)n);
+		checkDivisors(n, divisors, 1, "Knuth D");
+		checkDivisors(n + 1, divisors, 2, "Knuth D");
+		checkDivisors(2 * n, divisors, 3, "Knuth D");
+		checkDivisors(3 * n + 7, divisors, 4, "Knuth D");
+	}
+
+	// Newton con el umbral real: divisor y cociente por encima de él
+	size_t n = bigint::newton_threshold + 1;
+	std::vector<bigint> divisors = divisorsOf(n, 5);
+	checkDivisors(2 * n + 1, divisors, 6, "Newton");
+	checkDivisors(3 * n, divisors, 7, "Newton");
+
+	// Newton en tamaños pequeños frente a Knuth D
+	size_t saved = bigint::newton_threshold;
+	static const size_t NEWTON[] = { 4, 5, 9, 17, 40 };
+	for(size_t k = 0; k < sizeof(NEWTON) / sizeof(NEWTON[0]); k++)
+	{
+		std::vector<bigint> small = divisorsOf(NEWTON[k], (uint32_t)k + 8);
+		static const size_t FACTORS[] = { 2, 3, 5 };
+		for(size_t f = 0; f < sizeof(FACTORS) / sizeof(FACTORS[0]); f++)
+		{
+			bigint a = randomLimbs(FACTORS[f] * NEWTON[k] + f, (uint32_t)f);
+			for(size_t i = 0; i < small.size(); i++)
+			{
+				bigint::newton_threshold = saved;
+				bigint knuth = a / small[i];
+				bigint::newton_threshold = 4;
+				expect(a / small[i] == knuth, "Newton == Knuth D");
+			}
+			bigint::newton_threshold = 4;
+			checkDivisors(FACTORS[f] * NEWTON[k] + f, small, (uint32_t)f + 20, "Newton (umbral 4)");
+		}
+	}
+	bigint::newton_threshold = saved;
+
+	bool threw = false;
+	try
+	{
+		bigint(1) / bigint();
+	}
+	catch(const std::domain_error&)
+	{
+		threw = true;
+	}
+	expect(threw, "dividir entre 0 lanza domain_error");
+}
+
+// ==================== OPERADORES SOBRE TEMPORALES ====================
+
+/**
+ * @brief +, -, << y >> sobre temporales (o in-place con +=, <<=...) dan lo
+ * mismo que sobre copias, y mover deja el origen reutilizable
+ */
+static void testTemporaries(const std::vector<bigint>& values)
+{
+	const bigint big("1000");
+	for(size_t i = 0; i < values.size(); i++)
+	{
+		const bigint& a = values[i];
+		for(size_t j = 0; j < values.size(); j++)
+		{
+			const bigint& b = values[j];
+			bigint t(a);
+			expect((t += b) == a + b, "+= == +");
+#ifdef BIGINT_HAS_MOVE
+			expect(bigint(a) + b == a + b, "bigint&& + const bigint&");
+			expect(a + bigint(b) == a + b, "const bigint& + bigint&&");
+			expect(bigint(a) + bigint(b) == a + b, "bigint&& + bigint&&");
+			if(b <= a)
+				expect(bigint(a) - b == a - b, "bigint&& - const bigint&");
+#endif
+		}
+		bigint t(a);
+		expect((t <<= 25u) == a << 25u, "<<= == <<");
+		expect((t >>= 25u) == a, "(x << n) >> n == x");
+		expect((t <<= big) == a << big, "<<= bigint == << bigint");
+		expect(a << big == a << 1000u, "<< bigint == << unsigned");
+#ifdef BIGINT_HAS_MOVE
+		expect(bigint(a) << 25u == a << 25u, "bigint&& << unsigned");
+		expect(bigint(a) >> 25u == a >> 25u, "bigint&& >> unsigned");
+		expect(bigint(a) << big == a << big, "bigint&& << bigint");
+		expect(bigint(a) >> bigint(7) == a >> bigint(7), "bigint&& >> bigint");
+
+		bigint source(a);
+		bigint moved(std::move(source));
+		expect(moved == a, "constructor de movimiento");
+		source = a + a;
+		expect(source == a + a, "origen movido reutilizable");
+		bigint target;
+		target = std::move(source);
+		expect(target == a + a, "asignación de movimiento");
+#endif
+	}
+}
+
+// ==================== SUMAS FUSIONADAS ====================
+
+/**
+ * @brief lazy(a) + b + c... da lo mismo que los '+' encadenados, con
+ * operandos repetidos, de tamaños muy distintos y con acarreos largos
+ */
+static void testLazy(const std::vector<bigint>& values)
+{
+	for(size_t i = 0; i < values.size(); i++)
+	{
+		const bigint& a = values[i];
+		for(size_t j = 0; j < values.size(); j++)
+		{
+			const bigint& b = values[j];
+			const bigint& c = values[(i + 2 * j) % values.size()];
+			bigint chained = a + b + c;
+			expect(bigint(lazy(a) + b + c) == chained, "lazy(a) + b + c");
+			expect(bigint(a + lazy(b) + c) == chained, "a + lazy(b) + c");
+			expect(bigint(lazy(a) + (lazy(b) + lazy(c))) == chained, "lazy(a) + (lazy(b) + lazy(c))");
+			expect(bigint(lazy(a) + a + a) == a + a + a, "lazy(a) + a + a");
+
+			bigint target(a);
+			target += lazy(target) + b;
+			expect(target == a + a + b, "t += lazy(t) + b");
+		}
+	}
+
+	// Acarreo que recorre todos los limbs: (10^k - 1) + ... + 1
+	bigint nines(std::string(5000, '9'));
+	bigint one(1);
+	bigint fused = lazy(nines) + nines + nines + nines + nines + nines + nines + one;
+	expect(fused == nines + nines + nines + nines + nines + nines + nines + one, "ocho sumandos con acarreo largo");
+}
+
+// ==================== NÚCLEO SIMD ====================
+
+/**
+ * @brief a += b con el núcleo AVX2 (si la CPU lo tiene) o con el escalar
+ */
+static bigint addWith(bool simd, const bigint& a, const bigint& b)
+{
+	bool saved = bigint::simd_enabled;
+	bigint::simd_enabled = simd;
+	bigint r(a);
+	r += b;
+	bigint::simd_enabled = saved;
+	return(r);
+}
+
+/**
+ * @brief a -= b con el núcleo AVX2 (si la CPU lo tiene) o con el escalar
+ */
+static bigint subWith(bool simd, const bigint& a, const bigint& b)
+{
+	bool saved = bigint::simd_enabled;
+	bigint::simd_enabled = simd;
+	bigint r(a);
+	r -= b;
+	bigint::simd_enabled = saved;
+	return(r);
+}
+
+/**
+ * @brief b.subtractFrom(a): el resultado se escribe sobre el sustraendo
+ */
+static bigint subFromWith(bool simd, const bigint& a, const bigint& b)
+{
+	bool saved = bigint::simd_enabled;
+	bigint::simd_enabled = simd;
+	bigint r(b);
+	r.subtractFrom(a);
+	bigint::simd_enabled = saved;
+	return(r);
+}
+
+/**
+ * @brief Los núcleos AVX2 de suma y resta dan lo mismo que los escalares:
+ * todas las longitudes de 1 a 70 limbs (el AVX2 entra desde 16, en bloques
+ * de 8, con resto escalar), cadenas de acarreo y de borrow de punta a punta
+ * y destino que coincide con uno o los dos operandos
+ */
+static void testSimd()
+{
+	if(!bigint::simdAvailable())
+		std::printf("sin AVX2: los dos caminos son el escalar\n");
+	for(size_t n = 1; n <= 70; n++)
+	{
+		bigint a = randomLimbs(n, (uint32_t)n);
+		bigint ones = allOnes(n);
+		bigint power = limbPower(n);
+		static const size_t SHORTER[] = { 0, 1, 3, 8 };
+		for(size_t s = 0; s < sizeof(SHORTER) / sizeof(SHORTER[0]) && SHORTER[s] < n; s++)
+		{
+			bigint b = randomLimbs(n - SHORTER[s], (uint32_t)(n + s) * 31);
+			expect(addWith(true, a, b) == addWith(false, a, b), "AVX2 a + b == escalar");
+			expect(addWith(true, b, a) == addWith(false, b, a), "AVX2 b + a == escalar");
+			const bigint& big = (a < b) ? b : a;
+			const bigint& small = (a < b) ? a : b;
+			expect(subWith(true, big, small) == subWith(false, big, small), "AVX2 a - b == escalar");
+			expect(subFromWith(true, big, small) == subFromWith(false, big, small), "AVX2 subtractFrom == escalar");
+			expect(addWith(true, ones, b) == addWith(false, ones, b), "AVX2 unos + b == escalar");
+		}
+		for(int simd = 0; simd < 2; simd++)
+		{
+			expect(addWith(simd != 0, ones, bigint(1)) == power, "(2^(32n) - 1) + 1: acarreo de punta a punta");
+			expect(addWith(simd != 0, ones, ones) == power + power - bigint(2), "unos + unos");
+			expect(subWith(simd != 0, power, bigint(1)) == ones, "2^(32n) - 1: borrow de punta a punta");
+			expect(subFromWith(simd != 0, power, bigint(1)) == ones, "subtractFrom con borrow de punta a punta");
+			expect(subWith(simd != 0, ones, ones) == bigint(), "unos - unos");
+
+			bool saved = bigint::simd_enabled;
+			bigint::simd_enabled = (simd != 0);
+			bigint self(a);
+			self += self;
+			expect(self == a + a, "x += x (destino == los dos operandos)");
+			self -= self;
+			expect(self == bigint(), "x -= x");
+			bigint::simd_enabled = saved;
+		}
+	}
+}
+
+// ==================== COMPARACIÓN ====================
+
+/**
+ * @brief Signo de un resultado de compare()
+ */
+static int sign(int x)
+{
+	return((x > 0) - (x < 0));
+}
+
+/**
+ * @brief Comparación de referencia: por número de dígitos y después por texto
+ */
+static int compareText(const bigint& a, const bigint& b)
+{
+	std::string x = a.getStr();
+	std::string y = b.getStr();
+	if(x.size() != y.size())
+		return((x.size() < y.size()) ? -1 : 1);
+	return(sign(x.compare(y)));
+}
+
+/**
+ * @brief compare() y los seis operadores coinciden con la comparación de
+ * los textos, con valores de 3 a 6 limbs (dentro y fuera del buffer interno
+ * de 4), que difieren solo en el limb alto o solo en el bajo, y con el
+ * mismo valor guardado en el buffer interno o en el heap
+ */
+static void testCompare()
+{
+	std::vector<bigint> xs;
+	xs.push_back(bigint());
+	for(size_t n = 1; n <= 6; n++)
+	{
+		bigint x = randomLimbs(n, (uint32_t)n + 40);
+		xs.push_back(x);
+		xs.push_back(x + bigint(1));                 // Difiere en el limb bajo
+		xs.push_back(x + limbPower(n - 1));          // Difiere en el limb alto
+		xs.push_back(allOnes(n));
+		xs.push_back(limbPower(n));                  // Un limb más
+		bigint onHeap = allOnes(20);
+		onHeap = x;                                  // Mismo valor sobre un buffer mayor
+		xs.push_back(onHeap);
+		bigint shrunk = limbPower(12) + x;
+		shrunk %= limbPower(12);                     // Encoge desde 13 limbs
+		xs.push_back(shrunk);
+	}
+
+	for(size_t i = 0; i < xs.size(); i++)
+	{
+		for(size_t j = 0; j < xs.size(); j++)
+		{
+			const bigint& a = xs[i];
+			const bigint& b = xs[j];
+			int c = compareText(a, b);
+			expect(sign(a.compare(b)) == c, "compare == comparación de textos");
+			expect((a == b) == (c == 0) && (a != b) == (c != 0), "== y !=");
+			expect((a < b) == (c < 0) && (a >= b) == (c >= 0), "< y >=");
+			expect((a > b) == (c > 0) && (a <= b) == (c <= 0), "> y <=");
+		}
+	}
+}
+
+// ==================== DESPLAZAMIENTOS ====================
+
+/**
+ * @brief base^n por multiplicaciones sucesivas
+ */
+static bigint power(const bigint& base, unsigned int n)
+{
+	bigint result(1);
+	for(unsigned int i = 0; i < n; i++)
+		result *= base;
+	return(result);
+}
+
+/**
+ * @brief Lanza std::length_error: x.shiftLeftBits(n)
+ */
+static bool leftBitsThrows(const bigint& x, size_t n)
+{
+	bigint y(x);
+	try
+	{
+		y.shiftLeftBits(n);
+	}
+	catch(const std::length_error&)
+	{
+		return(true);
+	}
+	return(false);
+}
+
+/**
+ * @brief Lanza std::length_error sin tocar el valor: x.shiftLeftDecimal(n)
+ */
+static bool leftDecimalThrows(const bigint& x, size_t n)
+{
+	bigint y(x);
+	try
+	{
+		y.shiftLeftDecimal(n);
+	}
+	catch(const std::length_error&)
+	{
+		return(y == x);
+	}
+	return(false);
+}
+
+/**
+ * @brief Lanza std::length_error sin tocar el valor: x << n, x <<= n y
+ * x.shiftLeftDecimal(n) con contador bigint
+ */
+static bool leftDecimalThrows(const bigint& x, const bigint& n)
+{
+	size_t thrown = 0;
+	bigint y(x);
+	try
+	{
+		y.shiftLeftDecimal(n);
+	}
+	catch(const std::length_error&)
+	{
+		thrown++;
+	}
+	try
+	{
+		y <<= n;
+	}
+	catch(const std::length_error&)
+	{
+		thrown++;
+	}
+	try
+	{
+		bigint z = x << n;
+	}
+	catch(const std::length_error&)
+	{
+		thrown++;
+	}
+	return(thrown == 3 && y == x);
+}
+
+/**
+ * @brief Desplazamientos binarios y decimales frente a multiplicar y dividir
+ * por 2^n y 10^n: por 0, alrededor del tamaño de un limb (31/32/33), por
+ * contadores iguales o mayores que la longitud del valor, y con contadores
+ * desorbitados que deben lanzar std::length_error al momento
+ */
+static void testShifts(const std::vector<bigint>& values)
+{
+	static const unsigned int COUNTS[] = { 0, 1, 9, 10, 31, 32, 33, 63, 64, 65, 100, 1000 };
+	static const size_t COUNT_COUNT = sizeof(COUNTS) / sizeof(COUNTS[0]);
+	std::vector<bigint> twos;
+	std::vector<bigint> tens;
+	for(size_t c = 0; c < COUNT_COUNT; c++)
+	{
+		twos.push_back(power(bigint(2), COUNTS[c]));
+		tens.push_back(power(bigint(10), COUNTS[c]));
+	}
+
+	for(size_t i = 0; i < values.size(); i++)
+	{
+		const bigint& x = values[i];
+		size_t bits = x.bitLength();
+		if(bits == 0)
+			expect(x == bigint(), "bitLength() == 0 solo para 0");
+		else
+			expect(power(bigint(2), (unsigned int)bits - 1) <= x && x < power(bigint(2), (unsigned int)bits),
+				"2^(bitLength - 1) <= x < 2^bitLength");
+
+		for(size_t c = 0; c < COUNT_COUNT; c++)
+		{
+			unsigned int n = COUNTS[c];
+			bigint left(x);
+			bigint right(x);
+			expect(left.shiftLeftBits(n) == x * twos[c], "shiftLeftBits(n) == x * 2^n");
+			expect(right.shiftRightBits(n) == x / twos[c], "shiftRightBits(n) == x / 2^n");
+			expect(x.testBit(n) == ((x / twos[c]) % bigint(2) == bigint(1)), "testBit(n) == (x / 2^n) % 2");
+			expect((x << n) == x * tens[c], "x << n == x * 10^n");
+			expect((x >> n) == x / tens[c], "x >> n == x / 10^n");
+			expect((x << bigint(n)) == (x << n) && (x >> bigint(n)) == (x >> n), "contador bigint == contador unsigned");
+		}
+
+		// Contadores desde la longitud del valor: todo se va
+		static const size_t PAST[] = { 0, 1, 32, 1000 };
+		for(size_t p = 0; p < sizeof(PAST) / sizeof(PAST[0]); p++)
+		{
+			bigint right(x);
+			expect(right.shiftRightBits(bits + PAST[p]) == bigint(), "shiftRightBits(>= bitLength) == 0");
+			expect(!x.testBit(bits + PAST[p]), "testBit(>= bitLength) == false");
+		}
+		bigint right(x);
+		expect(right.shiftRightBits((size_t)-1) == bigint() && !x.testBit((size_t)-1), "contador binario máximo");
+		expect((x >> bigint("100000000000000000000000000000")) == bigint(), ">> con contador que no cabe en size_t");
+		bigint decimal(x);
+		expect(decimal.shiftRightDecimal((size_t)-1) == bigint(), "shiftRightDecimal((size_t)-1) == 0");
+	}
+
+	// Resultados que no caben en limb_buffer::MAX_LIMBS: fallan antes de calcular
+	bigint one(1);
+	bigint big = allOnes(100);
+	expect(leftBitsThrows(one, (size_t)-1) && leftBitsThrows(big, (size_t)-1), "shiftLeftBits((size_t)-1) lanza length_error");
+	expect(leftBitsThrows(one, (size_t)-32), "shiftLeftBits de casi todos los limbs lanza length_error");
+	expect(leftDecimalThrows(one, (size_t)-1), "shiftLeftDecimal((size_t)-1) lanza length_error");
+	expect(leftDecimalThrows(big, bigint("1099511627776")), "<< 2^40 dígitos lanza length_error");
+	expect(leftDecimalThrows(one, bigint("18446744073709551616")), "<< 2^64 dígitos lanza length_error");
+	expect(leftDecimalThrows(one, bigint("100000000000000000000000000000")), "<< 10^29 dígitos lanza length_error");
+	bigint zero;
+	expect(zero.shiftLeftBits((size_t)-1) == bigint(), "0 desplazado sigue siendo 0");
+	expect((zero << bigint("100000000000000000000000000000")) == bigint(), "0 << contador enorme == 0");
+}
+
+// ==================== MEMORIA TEMPORAL ====================
+
+/**
+ * @brief Con scratch_scope abiertos alrededor de lotes (y anidados dentro)
+ * las operaciones dan lo mismo que sin scope: los temporales que se liberan
+ * fuera de orden no pisan a los vivos, la arena se reutiliza de una vuelta
+ * a otra y los resultados sobreviven al scope en el que se crearon
+ */
+static void testScratch()
+{
+	// Karatsuba, Toom-3, NTT, Newton y la conversión decimal por mitades
+	bigint a = randomLimbs(30000, 61);
+	bigint b = randomLimbs(12000, 62);
+	bigint c = randomLimbs(1600, 63);
+	bigint ab = a * b;
+	bigint bc = b * c;
+	bigint q = a / c;
+	bigint r = a % c;
+	std::string text = b.getStr();
+
+	for(size_t round = 0; round < 3; round++)
+	{
+		bigint::scratch_scope outer;
+		bigint x;
+		{
+			bigint::scratch_scope inner;
+			x = a * b;
+		}
+		bigint y = b * c;
+		bigint quotient;
+		bigint remainder;
+		{
+			bigint::scratch_scope first;
+			bigint::scratch_scope second;
+			a.divmod(c, quotient, remainder);
+		}
+		std::string back = b.getStr();
+		expect(x == ab && y == bc, "productos dentro de scopes == sin scope");
+		expect(quotient == q && remainder == r, "división dentro de scopes == sin scope");
+		expect(back == text && bigint(back) == b, "conversión dentro de scopes == sin scope");
+		if(round == 1)
+			bigint::releaseThreadMemory();  // Con un scope abierto la arena sigue
+	}
+	bigint::releaseThreadMemory();
+	expect(a * b == ab && a / c == q, "después de releaseThreadMemory");
+
+	// Caché de bloques: buffers de varias clases liberados y vueltos a pedir
+	// en otro orden
+	std::vector<bigint> blocks;
+	for(size_t i = 0; i < 60; i++)
+		blocks.push_back(allOnes(5 + (i * 37) % 300));
+	for(size_t i = 0; i < blocks.size(); i += 2)
+		blocks[i] = bigint();
+	for(size_t i = blocks.size(); i > 0; i -= 2)
+		blocks[i - 2] = allOnes(5 + ((i - 2) * 37) % 300);
+	for(size_t i = 0; i < blocks.size(); i++)
+		expect(blocks[i] == allOnes(5 + (i * 37) % 300), "bloques reutilizados con su valor");
+}
+
+// ==================== SUMA DE RANGOS ====================
+
+/**
+ * @brief sum() y parallelSum() dan lo mismo que un bucle de +=
+ * 10000 sumandos (más de SUM_CARRY_INTERVAL = 4096 entre propagaciones)
+ * de hasta 40 limbs, la mayoría con todos los bits a 1 para que las
+ * columnas de 64 bits rocen el desbordamiento, y ~200000 limbs en total
+ * para que parallelSum reparta tramos entre 4 hilos
+ */
+static void testRangeSums(const std::vector<bigint>& values)
+{
+	std::vector<bigint> terms;
+	uint32_t seed = 99;
+	for(size_t i = 0; i < 10000; i++)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		if(seed % 8 == 0)
+			terms.push_back(values[(seed >> 8) % values.size()]);
+		else
+			terms.push_back(allOnes(1 + (seed >> 8) % 40));
+	}
+
+	bigint expected;
+	for(size_t i = 0; i < terms.size(); i++)
+		expected += terms[i];
+
+	expect(bigint::sum(terms.begin(), terms.end()) == expected, "sum == bucle de +=");
+	std::list<bigint> list(terms.begin(), terms.end());
+	expect(bigint::sum(list.begin(), list.end()) == expected, "sum sobre std::list == bucle de +=");
+	expect(bigint::sum(terms.begin(), terms.begin()) == bigint(), "sum de un rango vacío == 0");
+	expect(bigint::sum(values.begin(), values.end()) == bigint::parallelSum(values.begin(), values.end()),
+		"sum == parallelSum con pocos sumandos");
+
+	bigint::setThreadCount(4);
+	expect(bigint::parallelSum(terms.begin(), terms.end()) == expected, "parallelSum (4 hilos) == bucle de +=");
+	expect(bigint::parallelSum(terms.begin(), terms.begin()) == bigint(), "parallelSum de un rango vacío == 0");
+	bigint::setThreadCount(1);
+	expect(bigint::parallelSum(terms.begin(), terms.end()) == expected, "parallelSum (1 hilo) == bucle de +=");
+	bigint::setThreadCount(0);
+}
+
+// ==================== LECTURA EN FLUJO ====================
+
+/**
+ * @brief El parser da lo mismo que bigint(string) con cualquier troceado:
+ * textos alrededor de los bloques de 19 dígitos y las hojas de 576, y
+ * trozos que no coinciden con ninguno de los dos
+ */
+static void testParser()
+{
+	static const size_t DIGITS[] = { 1, 18, 19, 20, 575, 576, 577, 1152, 1153, 5000, 40000 };
+	static const size_t CHUNKS[] = { 1, 2, 3, 7, 19, 20, 577, 4097 };
+	uint32_t seed = 7;
+	for(size_t d = 0; d < sizeof(DIGITS) / sizeof(DIGITS[0]); d++)
+	{
+		std::string text = randomDigits(DIGITS[d], seed);
+		if(d % 3 == 0)
+			text.replace(0, text.size() / 2, text.size() / 2, '0');  // Ceros a la izquierda
+		bigint expected(text);
+		for(size_t c = 0; c < sizeof(CHUNKS) / sizeof(CHUNKS[0]); c++)
+		{
+			bigint::parser parser;
+			for(size_t pos = 0; pos < text.size(); pos += CHUNKS[c])
+				parser.feed(text.data() + pos, std::min(CHUNKS[c], text.size() - pos));
+			expect(parser.digits() == text.size(), "parser.digits() == dígitos recibidos");
+			expect(parser.finish() == expected, "parser a trozos == bigint(string)");
+		}
+		std::string nines(DIGITS[d], '9');
+		bigint::parser parser;
+		parser.feed(nines.data(), nines.size());
+		expect(parser.finish() == bigint(nines), "parser con todo nueves == bigint(string)");
+	}
+
+	// Un trozo con un no-dígito se descarta entero; el parser sigue usable
+	bigint::parser parser;
+	parser.feed("12", 2);
+	bool threw = false;
+	try
+	{
+		parser.feed("3x4", 3);
+	}
+	catch(const std::invalid_argument&)
+	{
+		threw = true;
+	}
+	expect(threw, "feed con un no-dígito lanza invalid_argument");
+	parser.feed("5", 1);
+	expect(parser.finish() == bigint(125), "el trozo inválido se descarta");
+	threw = false;
+	try
+	{
+		parser.finish();
+	}
+	catch(const std::invalid_argument&)
+	{
+		threw = true;
+	}
+	expect(threw, "finish sin dígitos lanza invalid_argument");
+}
+
+/**
+ * @brief operator>> lee como con un entero: salta blancos, para en el
+ * primer no-dígito y marca fail/eof igual que la lectura de un int
+ */
+static void testStreamInput()
+{
+	bigint x(777);
+	std::istringstream number("12345");
+	expect((number >> x) && x == bigint(12345) && number.eof(), "número hasta el final: eof sin fail");
+
+	std::istringstream stop("  00042abc");
+	expect((stop >> x) && x == bigint(42) && !stop.eof() && stop.peek() == 'a', "blancos y parada en el primer no-dígito");
+
+	std::istringstream two("18446744073709551616 340282366920938463463374607431768211456");
+	bigint y;
+	expect((two >> x >> y) && x == bigint("18446744073709551616") && y == bigint("340282366920938463463374607431768211456"),
+		"dos números seguidos");
+
+	x = bigint(777);
+	std::istringstream letters("abc");
+	expect(!(letters >> x) && letters.fail() && !letters.eof() && x == bigint(777), "sin dígitos: fail y valor sin tocar");
+
+	std::istringstream empty("");
+	expect(!(empty >> x) && empty.fail() && empty.eof() && x == bigint(777), "vacío: fail y eof");
+
+	std::istringstream blanks("   ");
+	expect(!(blanks >> x) && blanks.fail() && blanks.eof(), "solo blancos: fail y eof");
+
+	// Más largo que el trozo de 4096 caracteres de operator>>
+	uint32_t seed = 3;
+	std::string text = randomDigits(10000, seed);
+	std::istringstream big(text + "\n");
+	expect((big >> x) && x == bigint(text) && !big.eof(), "10000 dígitos == bigint(string)");
+
+	// Mismos estados que la lectura de un int
+	int n = 5;
+	std::istringstream intLetters("abc");
+	intLetters >> n;
+	std::istringstream bigLetters("abc");
+	bigLetters >> x;
+	expect(intLetters.rdstate() == bigLetters.rdstate(), "mismo estado que int con \"abc\"");
+	std::istringstream intNumber("42");
+	intNumber >> n;
+	std::istringstream bigNumber("42");
+	bigNumber >> x;
+	expect(intNumber.rdstate() == bigNumber.rdstate(), "mismo estado que int con \"42\"");
+}
+
+// ==================== RAÍCES ENTERAS ====================
+
+/**
+ * @brief r es la raíz n-ésima por defecto de x: r^n <= x < (r + 1)^n
+ */
+static bool isFloorRoot(const bigint& r, const bigint& x, unsigned int n)
+{
+	bigint next(r);
+	++next;
+	return(power(r, n) <= x && x < power(next, n));
+}
+
+/**
+ * @brief isqrt/iroot cumplen la cota en valores aleatorios (hasta 20000
+ * dígitos, donde trabaja el Newton con precisión creciente) y justo
+ * alrededor de potencias exactas
+ */
+static void testRoots(const std::vector<bigint>& values)
+{
+	static const unsigned int DEGREES[] = { 2, 3, 4, 5, 7, 31, 32, 33, 64, 1000 };
+	static const size_t DEGREE_COUNT = sizeof(DEGREES) / sizeof(DEGREES[0]);
+
+	std::vector<bigint> xs(values);
+	uint32_t seed = 11;
+	xs.push_back(randomDecimal(20000, seed));
+	for(size_t i = 0; i < xs.size(); i++)
+	{
+		const bigint& x = xs[i];
+		expect(isFloorRoot(x.isqrt(), x, 2), "isqrt: r^2 <= x < (r + 1)^2");
+		expect(x.iroot(2) == x.isqrt(), "iroot(2) == isqrt");
+		expect(x.iroot(1) == x, "iroot(1) == x");
+		for(size_t d = 0; d < DEGREE_COUNT; d++)
+			expect(isFloorRoot(x.iroot(DEGREES[d]), x, DEGREES[d]), "iroot: r^n <= x < (r + 1)^n");
+	}
+
+	// k^n - 1, k^n y k^n + 1: la raíz cambia justo en la potencia
+	static const char* const BASES[] = { "2", "3", "4294967295", "4294967296", "123456789012345678901234567890" };
+	for(size_t b = 0; b < sizeof(BASES) / sizeof(BASES[0]); b++)
+	{
+		bigint k(BASES[b]);
+		bigint below(k);
+		below -= bigint(1);
+		for(size_t d = 0; d < DEGREE_COUNT && DEGREES[d] <= 64; d++)
+		{
+			unsigned int n = DEGREES[d];
+			bigint exact = power(k, n);
+			bigint after(exact);
+			++after;
+			expect(exact.iroot(n) == k, "iroot(k^n) == k");
+			expect((exact - bigint(1)).iroot(n) == below, "iroot(k^n - 1) == k - 1");
+			expect(after.iroot(n) == k, "iroot(k^n + 1) == k");
+		}
+	}
+
+	expect(bigint().isqrt() == bigint() && bigint().iroot(5) == bigint(), "raíces de 0");
+	bool threw = false;
+	try
+	{
+		bigint(8).iroot(0);
+	}
+	catch(const std::domain_error&)
+	{
+		threw = true;
+	}
+	expect(threw, "iroot(0) lanza domain_error");
+}
+
+// ==================== ANCHO FIJO ====================
+
+#if __cplusplus >= 201402L
+typedef fixed_bigint<256> u256;
+
+// Se evalúa entero en tiempo de compilación: 1000000007 * 998244353
+static_assert(u256(1000000007u) * u256(998244353u)
+	== u256(998244359u) * u256(1000000000u) + u256(987710471u), "fixed_bigint: producto constexpr");
+static_assert((u256(0u) - u256(1u)).bitLength() == 256, "fixed_bigint: la resta da la vuelta");
+
+/**
+ * @brief El valor de un fixed_bigint como bigint
+ */
+static bigint widen(const u256& x)
+{
+	return(static_cast<bigint>(x));
+}
+
+/**
+ * @brief Cada operación de fixed_bigint<256> da lo mismo que la de bigint
+ * reducida módulo 2^256, incluidas las que desbordan o dan negativo
+ */
+static void testFixed(const std::vector<bigint>& values)
+{
+	bigint mod(1);
+	mod.shiftLeftBits(256);
+	std::vector<bigint> xs;
+	for(size_t i = 0; i < values.size(); i++)
+		xs.push_back(values[i] % mod);
+	xs.push_back(mod - bigint(1));
+	xs.push_back(allOnes(4));
+
+	for(size_t i = 0; i < xs.size(); i++)
+	{
+		const bigint& a = xs[i];
+		u256 fa(a);
+		expect(widen(fa) == a, "bigint -> u256 -> bigint");
+		expect(fa.getStr() == a.getStr(), "getStr");
+		expect(u256(a.getStr()) == fa, "u256(string)");
+		for(size_t j = 0; j < xs.size(); j++)
+		{
+			const bigint& b = xs[j];
+			u256 fb(b);
+			expect(widen(fa + fb) == (a + b) % mod, "+ módulo 2^256");
+			expect(widen(fa - fb) == (a + mod - b) % mod, "- módulo 2^256");
+			expect(widen(fa * fb) == (a * b) % mod, "* módulo 2^256");
+			expect((fa < fb) == (a < b) && (fa == fb) == (a == b), "comparación");
+			if(b != bigint())
+			{
+				expect(widen(fa / fb) == a / b, "/");
+				expect(widen(fa % fb) == a % b, "%");
+			}
+		}
+		for(unsigned int n = 0; n < 300; n += 37)
+		{
+			expect(widen(fa << n) == (a << n) % mod, "<< decimal módulo 2^256");
+			expect(widen(fa >> n) == (a >> n), ">> decimal");
+			u256 shifted(fa);
+			bigint wide(a);
+			expect(widen(shifted.shiftLeftBits(n)) == wide.shiftLeftBits(n) % mod, "shiftLeftBits módulo 2^256");
+		}
+	}
+
+	u256 max(mod - bigint(1));
+	expect(++max == u256(0u), "++ da la vuelta en 2^256 - 1");
+
+	bool threw = false;
+	try
+	{
+		u256 tooBig(mod);
+	}
+	catch(const std::overflow_error&)
+	{
+		threw = true;
+	}
+	expect(threw, "u256(2^256) lanza overflow_error");
+	threw = false;
+	try
+	{
+		u256 tooBig(mod.getStr());
+	}
+	catch(const std::overflow_error&)
+	{
+		threw = true;
+	}
+	expect(threw, "u256(\"2^256\") lanza overflow_error");
+}
+#endif
+
+// ==================== HASH ====================
+
+/**
+ * @brief Dos bigint iguales tienen el mismo hash() y std::hash
+ */
+static void expectSameHash(const bigint& a, const bigint& b, const char* what)
+{
+	bool same = (a == b) && (a.hash() == b.hash());
+#ifdef BIGINT_HAS_STD_HASH
+	same = same && (std::hash<bigint>()(a) == std::hash<bigint>()(b));
+#endif
+	expect(same, what);
+}
+
+/**
+ * @brief El hash depende solo del valor: da igual que venga de texto,
+ * de aritmética que crece y luego encoge (buffer en el heap con capacidad
+ * sobrante), de deserializar, de desplazamientos o del parser
+ */
+static void testHash(const std::vector<bigint>& values)
+{
+	for(size_t i = 0; i < values.size(); i++)
+	{
+		const bigint& x = values[i];
+		std::string text = x.getStr();
+		expectSameHash(x, bigint(text), "texto");
+
+		bigint copy;
+		copy = x;
+		expectSameHash(x, copy, "copia");
+
+		bigint big = allOnes(200);
+		expectSameHash(x, (big + x) - big, "(big + x) - big");
+		expectSameHash(x, (x * big) / big, "(x * big) / big");
+
+		std::vector<unsigned char> bytes;
+		x.serialize(bytes);
+		bigint back;
+		bigint::deserialize(&bytes[0], bytes.size(), back);
+		expectSameHash(x, back, "deserialize");
+
+		bigint shifted(x);
+		shifted.shiftLeftBits(77).shiftRightBits(77);
+		expectSameHash(x, shifted, "shiftLeftBits + shiftRightBits");
+		expectSameHash(x, (x << 50u) >> 50u, "<< + >> decimales");
+
+		bigint::parser parser;
+		parser.feed(text.data(), text.size());
+		expectSameHash(x, parser.finish(), "parser");
+
+		// Mismo valor en un objeto que antes tenía más limbs
+		bigint shrunk = allOnes(50);
+		shrunk = x;
+		expectSameHash(x, shrunk, "asignación sobre un buffer mayor");
+	}
+
+	// Valores distintos dan hashes distintos (con esta muestra, sin colisiones)
+	size_t collisions = 0;
+	for(size_t i = 0; i < values.size(); i++)
+		for(size_t j = i + 1; j < values.size(); j++)
+			if(values[i] != values[j] && values[i].hash() == values[j].hash())
+				collisions++;
+	expect(collisions == 0, "sin colisiones entre los valores de prueba");
+
+#ifdef BIGINT_HAS_STD_HASH
+	std::unordered_set<bigint> set(values.begin(), values.end());
+	for(size_t i = 0; i < values.size(); i++)
+		expect(set.count(bigint(values[i].getStr())) == 1, "unordered_set encuentra el valor construido desde texto");
+#endif
+}
+
+int main()
+{
+	std::vector<bigint> values = sampleValues();
+
+	testDivision(values);
+	testTemporaries(values);
+	testLazy(values);
+	testSimd();
+	testCompare();
+	testShifts(values);
+	testScratch();
+	testRangeSums(values);
+	testParser();
+	testStreamInput();
+	testRoots(values);
+#if __cplusplus >= 201402L
+	testFixed(values);
+#else
+	std::printf("sin C++14: se salta la sección de fixed_bigint\n");
+#endif
+	testHash(values);
+
+	if(failures != 0)
+	{
+		std::printf("%lu comprobaciones fallidas\n", (unsigned long)failures);
+		return(1);
+	}
+	std::printf("todas las comprobaciones coinciden\n");
+	return(0);
+}
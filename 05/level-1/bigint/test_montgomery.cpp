@@ -0,0 +1,222 @@
+#include "montgomery.hpp"
+#include "test_util.hpp"
+#include <cstdio>
+
+/**
+ * @file test_montgomery.cpp
+ * @brief Comprobación de montgomery_context y powmod contra la exponenciación
+ * con '%'
+ *
+ * La referencia es cuadrado y multiplicación reduciendo cada producto con
+ * '%'. Se prueban módulos impares a ambos lados de redc_threshold (CIOS por
+ * debajo, REDC por encima, y también REDC forzado en módulos pequeños),
+ * exponentes de todas las longitudes que eligen ventanas de 1 a 6 bits,
+ * bases mayores que el módulo, módulos pares (2^k * m, incluidas potencias
+ * de 2), el módulo 1 y los std::domain_error de un módulo 0 o par.
+ *
+ * Compilar y ejecutar (código 1 si algo falla):
+ *     c++ -O2 test_montgomery.cpp montgomery.cpp bigint.cpp -o test_montgomery
+ *     ./test_montgomery
+ */
+
+// ==================== REFERENCIA ====================
+
+/**
+ * @brief base^exponent mod modulus con '%' tras cada producto
+ */
+static bigint naivePowmod(const bigint& base, const bigint& exponent, const bigint& modulus)
+{
+	bigint result(1);
+	bigint b = base % modulus;
+	for(size_t i = exponent.bitLength(); i > 0; i--)
+	{
+		result = (result * result) % modulus;
+		if(exponent.testBit(i - 1))
+			result = (result * b) % modulus;
+	}
+	return(result % modulus);
+}
+
+/**
+ * @brief Exponentes de 0 a 700 bits: ventanas de 1 (hasta 6 bits) a 6
+ * (desde 672), con todo unos (ventanas llenas) y con ceros largos
+ */
+static std::vector<bigint> sampleExponents(size_t maxBits)
+{
+	static const size_t BITS[] = { 5, 6, 7, 23, 24, 79, 80, 239, 240, 671, 672, 700 };
+	std::vector<bigint> exponents;
+	exponents.push_back(bigint());
+	exponents.push_back(bigint(1));
+	exponents.push_back(bigint(2));
+	for(size_t i = 0; i < sizeof(BITS) / sizeof(BITS[0]) && BITS[i] <= maxBits; i++)
+	{
+		bigint ones(1);
+		ones.shiftLeftBits(BITS[i]);
+		exponents.push_back(ones - bigint(1));            // Todo unos
+		bigint sparse(1);
+		sparse.shiftLeftBits(BITS[i] - 1);
+		exponents.push_back(sparse + bigint(5));          // Ceros largos en medio
+		exponents.push_back(randomLimbs((BITS[i] + 31) / 32, (uint32_t)BITS[i]) % ones);
+	}
+	return(exponents);
+}
+
+/**
+ * @brief Bases para un módulo: 0, 1, m - 1, m, m + 1, aleatoria menor y
+ * aleatoria mucho mayor que m
+ */
+static std::vector<bigint> sampleBases(const bigint& modulus, uint32_t seed)
+{
+	std::vector<bigint> bases;
+	bases.push_back(bigint());
+	bases.push_back(bigint(1));
+	bases.push_back(modulus - bigint(1));
+	bases.push_back(modulus);
+	bases.push_back(modulus + bigint(1));
+	bases.push_back(randomLimbs(modulus.bitLength() / 32 + 1, seed) % modulus);
+	bases.push_back(randomLimbs(modulus.bitLength() / 16 + 3, seed + 1));
+	return(bases);
+}
+
+/**
+ * @brief Módulo impar pseudoaleatorio de exactamente 'limbs' limbs
+ */
+static bigint oddModulus(size_t limbs, uint32_t seed)
+{
+	bigint m = randomLimbs(limbs, seed);
+	if(!m.testBit(0))
+		++m;
+	return(m);
+}
+
+// ==================== CASOS ====================
+
+/**
+ * @brief ctx.pow, powmod y las operaciones sueltas del contexto frente a la
+ * referencia con un módulo impar
+ */
+static void checkOdd(const bigint& modulus, const std::vector<bigint>& exponents, uint32_t seed, const char* what)
+{
+	montgomery_context ctx(modulus);
+	montgomery_context copy(ctx);
+	std::vector<bigint> bases = sampleBases(modulus, seed);
+	for(size_t i = 0; i < bases.size(); i++)
+	{
+		const bigint& b = bases[i];
+		for(size_t j = 0; j < exponents.size(); j++)
+		{
+			bigint expected = naivePowmod(b, exponents[j], modulus);
+			expect(ctx.pow(b, exponents[j]) == expected, what);
+			expect(copy.pow(b, exponents[j]) == expected, "copia del contexto");
+			expect(powmod(b, exponents[j], modulus) == expected, "powmod con módulo impar");
+		}
+		bigint reduced = b % modulus;
+		bigint mont = ctx.toMontgomery(b);
+		expect(ctx.fromMontgomery(mont) == reduced, "fromMontgomery(toMontgomery(x)) == x mod N");
+		bigint other = bases[(i + 3) % bases.size()] % modulus;
+		bigint product = ctx.multiply(mont, ctx.toMontgomery(other));
+		expect(ctx.fromMontgomery(product) == (reduced * other) % modulus, "multiply en forma de Montgomery");
+	}
+}
+
+/**
+ * @brief Módulos de 1 a 200 limbs: CIOS y REDC con el umbral real, y REDC
+ * forzado en los pequeños
+ */
+static void testOdd()
+{
+	std::vector<bigint> all = sampleExponents(700);
+	std::vector<bigint> short80 = sampleExponents(80);
+	static const size_t SMALL[] = { 1, 2, 3, 5, 8 };
+	for(size_t i = 0; i < sizeof(SMALL) / sizeof(SMALL[0]); i++)
+		checkOdd(oddModulus(SMALL[i], (uint32_t)i + 1), all, (uint32_t)i, "ctx.pow (CIOS)");
+	checkOdd(bigint(3), all, 7, "ctx.pow con N = 3");
+	checkOdd(allOnes(4), all, 8, "ctx.pow con N = 2^128 - 1");
+
+	size_t threshold = montgomery_context::redc_threshold;
+	size_t around[] = { threshold - 1, threshold, threshold + 1 };
+	for(size_t i = 0; i < sizeof(around) / sizeof(around[0]); i++)
+		checkOdd(oddModulus(around[i], (uint32_t)around[i]), short80, (uint32_t)i, "ctx.pow alrededor de redc_threshold");
+
+	montgomery_context::redc_threshold = 1;
+	for(size_t i = 0; i < sizeof(SMALL) / sizeof(SMALL[0]); i++)
+		checkOdd(oddModulus(SMALL[i], (uint32_t)i + 1), all, (uint32_t)i, "ctx.pow (REDC forzado)");
+	montgomery_context::redc_threshold = threshold;
+}
+
+/**
+ * @brief powmod con módulo par 2^k * m frente a la referencia: potencias
+ * de 2 puras y con parte impar de uno o varios limbs, bases pares e impares
+ */
+static void testEven()
+{
+	static const size_t SHIFTS[] = { 1, 2, 5, 31, 32, 33, 100 };
+	static const size_t ODD[] = { 0, 1, 3 };
+	std::vector<bigint> exponents = sampleExponents(240);
+	for(size_t s = 0; s < sizeof(SHIFTS) / sizeof(SHIFTS[0]); s++)
+	{
+		for(size_t o = 0; o < sizeof(ODD) / sizeof(ODD[0]); o++)
+		{
+			bigint modulus = (ODD[o] == 0) ? bigint(1) : oddModulus(ODD[o], (uint32_t)(s + o));
+			modulus.shiftLeftBits(SHIFTS[s]);
+			std::vector<bigint> bases = sampleBases(modulus, (uint32_t)s);
+			bases.push_back(bigint(2));
+			bases.push_back(bigint(6));
+			for(size_t i = 0; i < bases.size(); i++)
+				for(size_t j = 0; j < exponents.size(); j++)
+					expect(powmod(bases[i], exponents[j], modulus) == naivePowmod(bases[i], exponents[j], modulus),
+						"powmod con módulo par");
+		}
+	}
+}
+
+/**
+ * @brief Módulo 1 y los errores de un módulo 0 o de un contexto par
+ */
+static void testEdges()
+{
+	std::vector<bigint> exponents = sampleExponents(80);
+	for(size_t j = 0; j < exponents.size(); j++)
+		expect(powmod(bigint(12345), exponents[j], bigint(1)) == bigint(), "powmod módulo 1 == 0");
+
+	bool threw = false;
+	try
+	{
+		powmod(bigint(2), bigint(3), bigint());
+	}
+	catch(const std::domain_error&)
+	{
+		threw = true;
+	}
+	expect(threw, "powmod con módulo 0 lanza domain_error");
+
+	static const unsigned int BAD[] = { 0, 1, 2, 4096 };
+	for(size_t i = 0; i < sizeof(BAD) / sizeof(BAD[0]); i++)
+	{
+		threw = false;
+		try
+		{
+			montgomery_context ctx(bigint(BAD[i]));
+		}
+		catch(const std::domain_error&)
+		{
+			threw = true;
+		}
+		expect(threw, "montgomery_context con módulo par o < 2 lanza domain_error");
+	}
+}
+
+int main()
+{
+	testOdd();
+	testEven();
+	testEdges();
+
+	if(failures != 0)
+	{
+		std::printf("%lu comprobaciones fallidas\n", (unsigned long)failures);
+		return(1);
+	}
+	std::printf("montgomery_context y powmod coinciden con la referencia\n");
+	return(0);
+}
@@ -0,0 +1,104 @@
+#include "bigint.hpp"
+#include "test_util.hpp"
+#include <cstdio>
+
+/**
+ * @file test_mul.cpp
+ * @brief Comprobación de los niveles de multiplicación contra el escolar
+ *
+ * Multiplica operandos aleatorios, de todo unos y desequilibrados con
+ * tamaños a ambos lados de cada umbral (karatsuba_threshold,
+ * toom3_threshold y ntt_threshold) y compara el producto con el del
+ * algoritmo escolar, que se fuerza subiendo karatsuba_threshold. Alrededor
+ * del límite de puntos de la NTT (an + bn = 2^23 limbs) el escolar es
+ * inabarcable, así que la referencia es Karatsuba/Toom-3 con la NTT
+ * desactivada, ya comprobados contra el escolar en los casos anteriores.
+ *
+ * Compilar y ejecutar (código 1 si algún producto no coincide):
+ *     c++ -O2 test_mul.cpp bigint.cpp -o test_mul
+ *     ./test_mul
+ */
+
+// Límite de la NTT en bigint.cpp (NTT_MAX_POINTS): an + bn <= 2^23 limbs
+static const size_t NTT_MAX_POINTS = (size_t)1 << 23;
+
+// ==================== REFERENCIAS ====================
+
+/**
+ * @brief Producto con el algoritmo escolar en todos los tamaños
+ */
+static bigint schoolbook(const bigint& a, const bigint& b)
+{
+	size_t saved = bigint::karatsuba_threshold;
+	bigint::karatsuba_threshold = (size_t)-1;
+	bigint r = a * b;
+	bigint::karatsuba_threshold = saved;
+	return(r);
+}
+
+/**
+ * @brief Producto sin NTT (Karatsuba / Toom-3 según los umbrales)
+ */
+static bigint withoutNTT(const bigint& a, const bigint& b)
+{
+	size_t saved = bigint::ntt_threshold;
+	bigint::ntt_threshold = (size_t)-1;
+	bigint r = a * b;
+	bigint::ntt_threshold = saved;
+	return(r);
+}
+
+// ==================== CASOS ====================
+
+static void check(const char* kind, size_t an, size_t bn, const bigint& a, const bigint& b,
+	bigint (*reference)(const bigint&, const bigint&))
+{
+	bool ok = (a * b == reference(a, b)) && (b * a == reference(b, a));
+	std::printf("%-5s %-10s %8lu x %-8lu\n", ok ? "ok" : "FALLO", kind,
+		(unsigned long)an, (unsigned long)bn);
+	if(!ok)
+		failures++;
+}
+
+/**
+ * @brief Operandos equilibrados, de todo unos y desequilibrados de bn limbs
+ */
+static void checkAround(size_t bn)
+{
+	check("aleatorio", bn, bn, randomLimbs(bn, (uint32_t)bn), randomLimbs(bn, (uint32_t)bn * 7 + 1), schoolbook);
+	check("unos", bn, bn, allOnes(bn), allOnes(bn), schoolbook);
+	check("unos/aleat", bn, bn, allOnes(bn), randomLimbs(bn, (uint32_t)bn + 3), schoolbook);
+	check("desequil.", 3 * bn + 1, bn, randomLimbs(3 * bn + 1, 11), randomLimbs(bn, 13), schoolbook);
+	check("desequil.", bn + bn / 3, bn, randomLimbs(bn + bn / 3, 17), allOnes(bn), schoolbook);
+}
+
+int main()
+{
+	const size_t thresholds[] = {
+		bigint::karatsuba_threshold, bigint::toom3_threshold, bigint::ntt_threshold
+	};
+	for(size_t t = 0; t < sizeof(thresholds) / sizeof(thresholds[0]); t++)
+	{
+		size_t limit = thresholds[t];
+		size_t sizes[] = { limit - 1, limit, limit + 1, limit + limit / 2 };
+		for(size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+			checkAround(sizes[i]);
+	}
+
+	// Límite de la NTT: justo dentro (una sola NTT) y justo fuera (troceado)
+	size_t bn = bigint::ntt_threshold + 1;
+	for(size_t total = NTT_MAX_POINTS; total <= NTT_MAX_POINTS + 1; total++)
+	{
+		size_t an = total - bn;
+		check("límite ntt", an, bn, randomLimbs(an, 19), randomLimbs(bn, 23), withoutNTT);
+		check("límite ntt", an, bn, allOnes(an), allOnes(bn), withoutNTT);
+	}
+
+	if(failures != 0)
+	{
+		std::printf("%lu productos distintos\n", (unsigned long)failures);
+		return(1);
+	}
+	std::printf("todos los productos coinciden\n");
+	return(0);
+}
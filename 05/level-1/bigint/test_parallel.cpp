@@ -0,0 +1,73 @@
+#include "bigint.hpp"
+#include "test_util.hpp"
+#include <cstdio>
+
+/**
+ * @file test_parallel.cpp
+ * @brief Comprobación de la multiplicación en paralelo contra la de un hilo
+ *
+ * Calcula los mismos productos aleatorios de 1000 a 100000 limbs
+ * (equilibrados, cuadrados y desequilibrados, así que pasan por Karatsuba,
+ * Toom-3 y NTT) con setThreadCount(1) y con setThreadCount(4), y exige
+ * que los resultados sean idénticos.
+ *
+ * Compilar y ejecutar (código 1 si algún producto difiere):
+ *     c++ -std=c++11 -O2 -pthread test_parallel.cpp bigint.cpp -o test_parallel
+ *     ./test_parallel
+ *
+ * Sin C++11 no hay pool: el programa lo avisa y termina sin comprobar nada.
+ */
+
+/**
+ * @brief Un producto de an x bn limbs
+ */
+struct product
+{
+	size_t an;
+	size_t bn;
+};
+
+int main()
+{
+	static const product PRODUCTS[] = {
+		{ 1000, 1000 }, { 1024, 1024 }, { 3000, 3000 }, { 10000, 10000 },
+		{ 30000, 30000 }, { 100000, 100000 }, { 100000, 1500 },
+		{ 100000, 20000 }, { 50000, 40000 }
+	};
+	static const size_t PRODUCT_COUNT = sizeof(PRODUCTS) / sizeof(PRODUCTS[0]);
+
+	bigint::setThreadCount(4);
+	if(bigint::getThreadCount() < 2)
+	{
+		std::printf("sin hilos (compilado sin C++11): nada que comprobar\n");
+		return(0);
+	}
+
+	for(size_t i = 0; i < PRODUCT_COUNT; i++)
+	{
+		const product& p = PRODUCTS[i];
+		bigint a = randomLimbs(p.an, (uint32_t)(2 * i + 1));
+		bigint b = randomLimbs(p.bn, (uint32_t)(2 * i + 2));
+
+		bigint::setThreadCount(1);
+		bigint serial = a * b;
+		bigint serialSquare = b * b;
+		bigint::setThreadCount(4);
+		bigint parallel = a * b;
+		bigint parallelSquare = b * b;
+
+		bool ok = (serial == parallel) && (serialSquare == parallelSquare);
+		std::printf("%-5s %6lu x %-6lu\n", ok ? "ok" : "FALLO", (unsigned long)p.an, (unsigned long)p.bn);
+		if(!ok)
+			failures++;
+	}
+	bigint::setThreadCount(0);
+
+	if(failures != 0)
+	{
+		std::printf("%lu productos distintos\n", (unsigned long)failures);
+		return(1);
+	}
+	std::printf("1 y 4 hilos dan los mismos productos\n");
+	return(0);
+}
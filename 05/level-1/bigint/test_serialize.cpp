@@ -0,0 +1,166 @@
+#include "bigint.hpp"
+#include "test_util.hpp"
+#include <cstdio>
+
+/**
+ * @file test_serialize.cpp
+ * @brief Comprobación de la serialización binaria, bigint_view y getStr
+ *
+ * Con valores aleatorios y de borde (0, un limb, 4 y 5 limbs alrededor del
+ * buffer interno, y 127/128/16384 limbs para que la cabecera LEB128 ocupe
+ * uno, dos o tres bytes) comprueba que deserialize(serialize(x)),
+ * bigint_view::parse(...).toBigint() y bigint(getStr()) devuelven x, que
+ * las vistas comparan igual que los bigint, y que las codificaciones con
+ * relleno, truncadas o no canónicas lanzan std::invalid_argument.
+ *
+ * Compilar y ejecutar (código 1 si algo falla):
+ *     c++ -O2 test_serialize.cpp bigint.cpp -o test_serialize
+ *     ./test_serialize
+ */
+
+// ==================== IDA Y VUELTA ====================
+
+/**
+ * @brief Las tres vías de ida y vuelta devuelven el mismo valor
+ */
+static void checkRoundTrip(const bigint& x)
+{
+	std::vector<unsigned char> bytes;
+	x.serialize(bytes);
+	expect(bytes.size() == x.serializedSize(), "serializedSize() == bytes escritos");
+
+	std::vector<unsigned char> direct(x.serializedSize());
+	expect(x.serialize(&direct[0]) == direct.size() && direct == bytes, "serialize(puntero) == serialize(vector)");
+
+	bigint back;
+	expect(bigint::deserialize(&bytes[0], bytes.size(), back) == bytes.size(), "deserialize consume el registro");
+	expect(back == x, "deserialize(serialize(x)) == x");
+
+	bigint_view view;
+	expect(bigint_view::parse(&bytes[0], bytes.size(), view) == bytes.size(), "parse consume el registro");
+	expect(view.toBigint() == x, "parse(serialize(x)).toBigint() == x");
+	expect(view.limbCount() * 4 <= bytes.size(), "limbCount() cabe en el registro");
+
+	expect(bigint(x.getStr()) == x, "bigint(getStr()) == x");
+}
+
+/**
+ * @brief Registros seguidos en un buffer: las vistas se leen en orden y
+ * comparan igual que los bigint originales
+ */
+static void checkStream(const std::vector<bigint>& values)
+{
+	std::vector<unsigned char> bytes;
+	for(size_t i = 0; i < values.size(); i++)
+		values[i].serialize(bytes);
+
+	std::vector<bigint_view> views;
+	for(size_t pos = 0; pos < bytes.size(); )
+	{
+		bigint_view view;
+		pos += bigint_view::parse(&bytes[pos], bytes.size() - pos, view);
+		views.push_back(view);
+	}
+	expect(views.size() == values.size(), "un registro por valor");
+	if(views.size() != values.size())
+		return;
+	for(size_t i = 0; i < values.size(); i++)
+	{
+		expect(views[i].toBigint() == values[i], "registro i del buffer == valor i");
+		for(size_t j = 0; j < values.size(); j++)
+		{
+			int a = views[i].compare(views[j]);
+			int b = values[i].compare(values[j]);
+			expect((a < 0) == (b < 0) && (a > 0) == (b > 0), "bigint_view::compare == bigint::compare");
+		}
+	}
+}
+
+// ==================== CODIFICACIONES INVÁLIDAS ====================
+
+static void expectInvalid(const unsigned char* data, size_t size, const char* what)
+{
+	bool viewThrew = false;
+	bool valueThrew = false;
+	try
+	{
+		bigint_view view;
+		bigint_view::parse(data, size, view);
+	}
+	catch(const std::invalid_argument&)
+	{
+		viewThrew = true;
+	}
+	try
+	{
+		bigint value;
+		bigint::deserialize(data, size, value);
+	}
+	catch(const std::invalid_argument&)
+	{
+		valueThrew = true;
+	}
+	expect(viewThrew && valueThrew, what);
+}
+
+static void checkInvalid()
+{
+	static const unsigned char one[] = { 0x01, 0x07, 0x00, 0x00, 0x00 };
+	static const unsigned char padded[] = { 0x80, 0x00 };
+	static const unsigned char paddedOne[] = { 0x81, 0x00, 0x07, 0x00, 0x00, 0x00 };
+	static const unsigned char header[] = { 0x80 };
+	static const unsigned char shortLimb[] = { 0x01, 0x07, 0x00, 0x00 };
+	static const unsigned char shortCount[] = { 0x02, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00 };
+	static const unsigned char zeroTop[] = { 0x01, 0x00, 0x00, 0x00, 0x00 };
+	static const unsigned char zeroTop2[] = { 0x02, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+	static const unsigned char huge[] = {
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01
+	};
+
+	bigint value;
+	expect(bigint::deserialize(one, sizeof(one), value) == sizeof(one) && value == bigint(7), "registro válido de referencia");
+
+	expectInvalid(padded, sizeof(padded), "cabecera con relleno (0x80 0x00)");
+	expectInvalid(paddedOne, sizeof(paddedOne), "cabecera con relleno (0x81 0x00)");
+	expectInvalid(one, 0, "buffer vacío");
+	expectInvalid(header, sizeof(header), "cabecera LEB128 cortada");
+	expectInvalid(shortLimb, sizeof(shortLimb), "limb cortado");
+	expectInvalid(shortCount, sizeof(shortCount), "faltan limbs");
+	expectInvalid(zeroTop, sizeof(zeroTop), "limb alto a 0 (un limb)");
+	expectInvalid(zeroTop2, sizeof(zeroTop2), "limb alto a 0 (dos limbs)");
+	expectInvalid(huge, sizeof(huge), "cabecera que no cabe en size_t");
+}
+
+int main()
+{
+	std::vector<bigint> values;
+	values.push_back(bigint());
+	values.push_back(bigint(1));
+	values.push_back(allOnes(1));            // 1 limb lleno
+	values.push_back(limbPower(1));          // 2 limbs
+	values.push_back(allOnes(4));            // 4 limbs: el buffer interno lleno
+	values.push_back(limbPower(4));          // 5 limbs: ya en el heap
+	values.push_back(allOnes(127));          // cabecera de 1 byte (127)
+	values.push_back(limbPower(127));        // cabecera de 2 bytes (128)
+	values.push_back(allOnes(16383));        // cabecera de 2 bytes (16383)
+	values.push_back(limbPower(16383));      // cabecera de 3 bytes (16384)
+
+	uint32_t seed = 12345;
+	static const size_t DIGITS[] = { 1, 9, 10, 19, 20, 38, 39, 40, 100, 1234, 5000, 20000 };
+	for(size_t i = 0; i < sizeof(DIGITS) / sizeof(DIGITS[0]); i++)
+		for(size_t k = 0; k < 3; k++)
+			values.push_back(randomDecimal(DIGITS[i], seed));
+
+	for(size_t i = 0; i < values.size(); i++)
+		checkRoundTrip(values[i]);
+	checkStream(values);
+	checkInvalid();
+
+	if(failures != 0)
+	{
+		std::printf("%lu comprobaciones fallidas\n", (unsigned long)failures);
+		return(1);
+	}
+	std::printf("serialización, vistas y texto coinciden en %lu valores\n", (unsigned long)values.size());
+	return(0);
+}
@@ -0,0 +1,213 @@
+#include "signed_bigint.hpp"
+#include "test_util.hpp"
+#include <climits>
+#include <cstdio>
+#include <sstream>
+
+/**
+ * @file test_signed.cpp
+ * @brief Comprobación de signed_bigint contra aritmética con desplazamiento
+ *
+ * Un valor v con |v| < M se representa sin signo como v + M, así que la
+ * referencia de cada operación es aritmética de bigint sobre números no
+ * negativos: (a + b) + 2M = A + B, (a - b) + 2M = A + 2M - B y
+ * a * b + M^2 = A * B + 2M^2 - M * (A + B). Además, los valores que caben
+ * en un int se comparan con la aritmética nativa, y se comprueban los
+ * bordes del cero: x - x, -0, "-0", -- y ++ cruzando el 0 y compare entre
+ * los distintos ceros.
+ *
+ * Compilar y ejecutar (código 1 si algo falla):
+ *     c++ -O2 test_signed.cpp signed_bigint.cpp bigint.cpp -o test_signed
+ *     ./test_signed
+ */
+
+// ==================== REFERENCIA ====================
+
+/**
+ * @brief v + offset como bigint (offset > |v|)
+ */
+static bigint shifted(const signed_bigint& v, const bigint& offset)
+{
+	if(v.isNegative())
+		return(offset - v.abs());
+	return(offset + v.abs());
+}
+
+/**
+ * @brief El cero nunca es negativo
+ */
+static bool canonical(const signed_bigint& v)
+{
+	return(v.abs() != bigint() || !v.isNegative());
+}
+
+/**
+ * @brief Texto de un int con la librería estándar
+ */
+static std::string intText(long long v)
+{
+	std::ostringstream out;
+	out << v;
+	return(out.str());
+}
+
+// ==================== CASOS ====================
+
+/**
+ * @brief Valores de prueba con los dos signos, del 0 a cientos de dígitos
+ */
+static std::vector<signed_bigint> sampleValues()
+{
+	static const int SMALL[] = { 0, 1, -1, 2, -2, 7, -7, 1000, -1000, INT_MAX, INT_MIN };
+	std::vector<signed_bigint> values;
+	for(size_t i = 0; i < sizeof(SMALL) / sizeof(SMALL[0]); i++)
+		values.push_back(signed_bigint(SMALL[i]));
+	static const size_t DIGITS[] = { 9, 10, 20, 40, 100, 500 };
+	uint32_t seed = 14;
+	for(size_t i = 0; i < sizeof(DIGITS) / sizeof(DIGITS[0]); i++)
+	{
+		bigint magnitude = randomDecimal(DIGITS[i], seed);
+		values.push_back(signed_bigint(magnitude));
+		values.push_back(signed_bigint(magnitude, true));
+		values.push_back(signed_bigint(magnitude + bigint(1), true));  // Misma longitud, otro valor
+	}
+	return(values);
+}
+
+/**
+ * @brief +, -, *, +=, -=, *= y compare frente a la referencia desplazada,
+ * incluidos a - b con |b| > |a|, signos mezclados y operandos repetidos
+ */
+static void testArithmetic(const std::vector<signed_bigint>& values)
+{
+	bigint m(1);
+	for(size_t i = 0; i < values.size(); i++)
+		if(values[i].abs() >= m)
+			m = values[i].abs() + bigint(1);
+	bigint m2 = m + m;
+	bigint mm = m * m;
+
+	for(size_t i = 0; i < values.size(); i++)
+	{
+		const signed_bigint& a = values[i];
+		bigint sa = shifted(a, m);
+		for(size_t j = 0; j < values.size(); j++)
+		{
+			const signed_bigint& b = values[j];
+			bigint sb = shifted(b, m);
+
+			signed_bigint sum = a + b;
+			signed_bigint difference = a - b;
+			signed_bigint product = a * b;
+			expect(shifted(sum, m2) == sa + sb && canonical(sum), "a + b");
+			expect(shifted(difference, m2) == sa + m2 - sb && canonical(difference), "a - b");
+			expect(shifted(product, mm) == sa * sb + mm + mm - m * (sa + sb) && canonical(product), "a * b");
+
+			signed_bigint t(a);
+			expect((t += b) == sum && canonical(t), "+= == +");
+			t = a;
+			expect((t -= b) == difference && canonical(t), "-= == -");
+			t = a;
+			expect((t *= b) == product && canonical(t), "*= == *");
+
+			int c = a.compare(b);
+			int expected = sa.compare(sb);
+			expect((c < 0) == (expected < 0) && (c > 0) == (expected > 0), "compare == compare desplazado");
+			expect((a < b) == (c < 0) && (a >= b) == (c >= 0) && (a == b) == (c == 0), "operadores == compare");
+		}
+
+		signed_bigint self(a);
+		self += self;
+		expect(self == a + a && canonical(self), "x += x");
+		self = a;
+		self -= self;
+		expect(self.abs() == bigint() && !self.isNegative(), "x -= x da +0");
+		expect(shifted(-a, m) == m2 - sa && canonical(-a), "-x");
+		expect((a - a).getStr() == "0" && !(a - a).isNegative(), "x - x da +0");
+		expect(a + (-a) == signed_bigint() && !(a + (-a)).isNegative(), "x + (-x) da +0");
+		expect(signed_bigint(a.getStr()) == a, "signed_bigint(getStr()) == x");
+	}
+}
+
+/**
+ * @brief Con valores que caben en un int: mismo resultado y mismo texto
+ * que la aritmética nativa
+ */
+static void testNative()
+{
+	for(int x = -40; x <= 40; x += 3)
+	{
+		for(int y = -40; y <= 40; y += 7)
+		{
+			signed_bigint a(x);
+			signed_bigint b(y);
+			expect((a + b).getStr() == intText((long long)x + y), "a + b == int");
+			expect((a - b).getStr() == intText((long long)x - y), "a - b == int");
+			expect((a * b).getStr() == intText((long long)x * y), "a * b == int");
+			expect((a < b) == (x < y) && (a == b) == (x == y), "comparación == int");
+		}
+	}
+	expect(signed_bigint(INT_MIN).getStr() == intText(INT_MIN), "INT_MIN");
+	expect((signed_bigint(INT_MIN) - signed_bigint(1)).getStr() == intText((long long)INT_MIN - 1), "INT_MIN - 1");
+}
+
+/**
+ * @brief Los ceros: x - x, -0, "-0", magnitud 0 con signo, -- y ++
+ * cruzando el 0, y compare entre ellos
+ */
+static void testZero()
+{
+	signed_bigint plus;
+	signed_bigint minus = -plus;
+	signed_bigint text("-0");
+	signed_bigint flagged(bigint(), true);
+	signed_bigint difference = signed_bigint(5) - signed_bigint(5);
+	const signed_bigint* zeros[] = { &plus, &minus, &text, &flagged, &difference };
+	for(size_t i = 0; i < sizeof(zeros) / sizeof(zeros[0]); i++)
+	{
+		const signed_bigint& z = *zeros[i];
+		expect(!z.isNegative() && z.getStr() == "0", "el cero es +0");
+		for(size_t j = 0; j < sizeof(zeros) / sizeof(zeros[0]); j++)
+			expect(z.compare(*zeros[j]) == 0 && z == *zeros[j] && !(z < *zeros[j]), "compare entre ceros == 0");
+		expect(z < signed_bigint(1) && signed_bigint(-1) < z, "-1 < 0 < 1");
+	}
+
+	signed_bigint x(1);
+	expect((--x).getStr() == "0" && !x.isNegative(), "--1 da +0");
+	expect((--x).getStr() == "-1", "--0 da -1");
+	expect((x--).getStr() == "-1" && x.getStr() == "-2", "x-- devuelve el valor anterior");
+	expect((++x).getStr() == "-1", "++(-2) da -1");
+	expect((++x).getStr() == "0" && !x.isNegative(), "++(-1) da +0");
+	expect((x++).getStr() == "0" && x.getStr() == "1", "x++ devuelve el valor anterior");
+
+	// Cruce del 0 con magnitudes de varios limbs
+	bigint big = allOnes(6);
+	signed_bigint y(big, true);
+	y += signed_bigint(big);
+	expect(y.getStr() == "0" && !y.isNegative(), "-x + x da +0");
+	y -= signed_bigint(big + bigint(1));
+	expect(y.isNegative() && y.abs() == big + bigint(1), "0 - (x + 1) cambia de signo");
+	y += signed_bigint(big);
+	expect(y.getStr() == "-1", "-(x + 1) + x da -1");
+	++y;
+	expect(!y.isNegative() && y.getStr() == "0", "++ desde -1 grande da +0");
+	signed_bigint small(3);
+	small -= signed_bigint(big);
+	expect(small.isNegative() && small.abs() == big - bigint(3), "a - b con |b| > |a|");
+}
+
+int main()
+{
+	std::vector<signed_bigint> values = sampleValues();
+	testArithmetic(values);
+	testNative();
+	testZero();
+
+	if(failures != 0)
+	{
+		std::printf("%lu comprobaciones fallidas\n", (unsigned long)failures);
+		return(1);
+	}
+	std::printf("signed_bigint coincide con la referencia en %lu valores\n", (unsigned long)values.size());
+	return(0);
+}
@@ -0,0 +1,121 @@
+#ifndef TEST_UTIL
+#define TEST_UTIL
+
+#include "bigint.hpp"
+#include <cstdio>
+
+/**
+ * @file test_util.hpp
+ * @brief Utilidades comunes de los programas de prueba
+ *
+ * Contador de fallos y generadores de operandos con un LCG fijo, para que
+ * cada ejecución pruebe exactamente los mismos valores. Cada test_*.cpp es
+ * un programa independiente que incluye este fichero una sola vez.
+ */
+
+static size_t failures = 0;
+
+/**
+ * @brief Cuenta y avisa de una comprobación fallida
+ */
+static inline void expect(bool ok, const char* what)
+{
+	if(!ok)
+	{
+		std::printf("FALLO %s\n", what);
+		failures++;
+	}
+}
+
+// ==================== VALORES ====================
+
+/**
+ * @brief Siguiente paso del LCG
+ */
+static inline uint32_t nextRandom(uint32_t& seed)
+{
+	seed = seed * 1664525u + 1013904223u;
+	return(seed);
+}
+
+/**
+ * @brief Texto pseudoaleatorio de 'digits' dígitos (puede empezar por 0)
+ */
+static inline std::string randomDigits(size_t digits, uint32_t& seed)
+{
+	std::string text(digits, '0');
+	for(size_t i = 0; i < digits; i++)
+		text[i] = (char)('0' + (nextRandom(seed) >> 24) % 10);
+	return(text);
+}
+
+/**
+ * @brief bigint pseudoaleatorio de exactamente 'digits' dígitos decimales
+ */
+static inline bigint randomDecimal(size_t digits, uint32_t& seed)
+{
+	std::string text = randomDigits(digits, seed);
+	if(text[0] == '0')
+		text[0] = '1';
+	return(bigint(text));
+}
+
+/**
+ * @brief 2^(32*limbs): un 1 seguido de 'limbs' limbs a 0
+ */
+static inline bigint limbPower(size_t limbs)
+{
+	bigint value(1);
+	value.shiftLeftBits(32 * limbs);
+	return(value);
+}
+
+/**
+ * @brief 2^(32*limbs) - 1: todos los limbs a 0xFFFFFFFF (máximo acarreo)
+ */
+static inline bigint allOnes(size_t limbs)
+{
+	return(limbPower(limbs) - bigint(1));
+}
+
+/**
+ * @brief 'limbs' limbs pseudoaleatorios; con top, el limb alto tiene su
+ * bit 31 a 1 y el número ocupa exactamente 'limbs' limbs
+ * Mitad alta y mitad baja por separado (la baja de 2^k limbs), así el
+ * coste es el de unos pocos desplazamientos y sumas por nivel
+ */
+static inline bigint randomBlock(size_t limbs, uint32_t& seed, bool top)
+{
+	if(limbs <= 8)
+	{
+		bigint value;
+		for(size_t i = 0; i < limbs; i++)
+		{
+			uint32_t limb = 0;
+			for(int b = 0; b < 4; b++)
+				limb = (limb << 8) | (nextRandom(seed) >> 24);
+			if(top && i == 0)
+				limb |= 0x80000000u;
+			value.shiftLeftBits(32);
+			value += bigint(limb);
+		}
+		return(value);
+	}
+	size_t low = 1;
+	while(2 * low < limbs)
+		low *= 2;
+	bigint value = randomBlock(limbs - low, seed, top);
+	value.shiftLeftBits(32 * low);
+	value += randomBlock(low, seed, false);
+	return(value);
+}
+
+/**
+ * @brief bigint pseudoaleatorio de exactamente 'limbs' limbs
+ */
+static inline bigint randomLimbs(size_t limbs, uint32_t seed)
+{
+	return(randomBlock(limbs, seed, true));
+}
+
+#endif
@@ -0,0 +1,272 @@
+#ifndef WORK_STEALING_POOL
+#define WORK_STEALING_POOL
+
+/**
+ * @file work_stealing_pool.hpp
+ * @brief Pool de hilos con robo de trabajo para el paralelismo fork-join
+ *
+ * Cada worker tiene su propia cola: añade y saca tareas por detrás (LIFO,
+ * lo más reciente sigue en caché) y, cuando se queda sin trabajo, roba por
+ * delante de las colas de los demás (las tareas más antiguas, que en una
+ * recursión divide-y-vencerás son las más grandes). Quien espera a un grupo
+ * no se bloquea: ejecuta tareas pendientes mientras tanto, así que las
+ * esperas anidadas no pueden dejar al pool sin hilos. Cada tarea ajena que
+ * se ejecuta esperando se apila sobre la espera, por eso solo se roba hasta
+ * MAX_HELP_DEPTH niveles; las de la cola propia se ejecutan siempre (cada
+ * tarea encolada tiene un dueño que acaba sacándola).
+ *
+ * Requiere C++11 (std::thread); bigint.cpp solo lo incluye en ese caso.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class work_stealing_pool
+{
+	public:
+		typedef void (*task_fn)(void*);
+
+		/**
+		 * @brief Grupo fork-join: cuenta las tareas pendientes y guarda la
+		 * primera excepción para relanzarla en wait()
+		 */
+		class task_group
+		{
+			private:
+				std::atomic<size_t> pending;
+				std::exception_ptr error;
+				std::mutex errorLock;
+
+				friend class work_stealing_pool;
+
+			public:
+				task_group() : pending(0) {}
+		};
+
+	private:
+		// Esperas anidadas que aún pueden robar tareas de otras colas
+		static const size_t MAX_HELP_DEPTH = 8;
+
+		struct task
+		{
+			task_fn fn;
+			void* arg;
+			task_group* group;
+		};
+
+		struct queue
+		{
+			std::mutex lock;
+			std::deque<task> tasks;
+		};
+
+		std::vector<queue*> queues;
+		std::vector<std::thread> threads;
+		std::atomic<bool> stopping;
+		std::atomic<size_t> queued;       // Tareas en cola (para dormir/despertar)
+		std::atomic<size_t> nextQueue;    // Reparto de las tareas externas
+		std::mutex sleepLock;
+		std::condition_variable wake;
+
+		work_stealing_pool(const work_stealing_pool&);
+		work_stealing_pool& operator=(const work_stealing_pool&);
+
+		/**
+		 * @brief Índice del worker del hilo actual en este pool (-1 si no es suyo)
+		 */
+		long currentIndex() const
+		{
+			return((current().pool == this) ? (long)current().index : -1);
+		}
+
+		struct workerId
+		{
+			const work_stealing_pool* pool;
+			size_t index;
+		};
+
+		static workerId& current()
+		{
+			static thread_local workerId id = { NULL, 0 };
+			return(id);
+		}
+
+		/**
+		 * @brief Tareas que el hilo actual está ejecutando dentro de wait()
+		 */
+		static size_t& helpDepth()
+		{
+			static thread_local size_t depth = 0;
+			return(depth);
+		}
+
+		/**
+		 * @brief Saca una tarea: primero de la cola propia (por detrás), si no
+		 * roba de las demás (por delante)
+		 * @param steal false para mirar solo la cola propia
+		 */
+		bool take(long self, task& out, bool steal = true)
+		{
+			size_t n = this->queues.size();
+			if(self >= 0)
+			{
+				queue& own = *this->queues[(size_t)self];
+				std::lock_guard<std::mutex> guard(own.lock);
+				if(!own.tasks.empty())
+				{
+					out = own.tasks.back();
+					own.tasks.pop_back();
+					this->queued--;
+					return(true);
+				}
+			}
+			if(!steal)
+				return(false);
+			size_t start = (self >= 0) ? (size_t)self + 1 : 0;
+			for(size_t i = 0; i < n; i++)
+			{
+				queue& victim = *this->queues[(start + i) % n];
+				std::lock_guard<std::mutex> guard(victim.lock);
+				if(!victim.tasks.empty())
+				{
+					out = victim.tasks.front();
+					victim.tasks.pop_front();
+					this->queued--;
+					return(true);
+				}
+			}
+			return(false);
+		}
+
+		/**
+		 * @brief Ejecuta una tarea y la descuenta de su grupo
+		 */
+		static void execute(const task& t)
+		{
+			try
+			{
+				t.fn(t.arg);
+			}
+			catch(...)
+			{
+				std::lock_guard<std::mutex> guard(t.group->errorLock);
+				if(!t.group->error)
+					t.group->error = std::current_exception();
+			}
+			t.group->pending.fetch_sub(1, std::memory_order_release);
+		}
+
+		void workerLoop(size_t index)
+		{
+			current().pool = this;
+			current().index = index;
+			task t;
+			while(!this->stopping.load())
+			{
+				if(this->take((long)index, t))
+				{
+					execute(t);
+					continue;
+				}
+				std::unique_lock<std::mutex> guard(this->sleepLock);
+				this->wake.wait(guard, [this]() {
+					return(this->stopping.load() || this->queued.load() > 0);
+				});
+			}
+		}
+
+	public:
+		/**
+		 * @brief Arranca el pool
+		 * @param workers Número de hilos worker (el hilo que espera también trabaja)
+		 */
+		explicit work_stealing_pool(size_t workers) : stopping(false), queued(0), nextQueue(0)
+		{
+			if(workers == 0)
+				workers = 1;
+			for(size_t i = 0; i < workers; i++)
+				this->queues.push_back(new queue());
+			for(size_t i = 0; i < workers; i++)
+				this->threads.push_back(std::thread(&work_stealing_pool::workerLoop, this, i));
+		}
+
+		/**
+		 * @brief Para y espera a todos los workers
+		 */
+		~work_stealing_pool()
+		{
+			{
+				std::lock_guard<std::mutex> guard(this->sleepLock);
+				this->stopping = true;
+			}
+			this->wake.notify_all();
+			for(size_t i = 0; i < this->threads.size(); i++)
+				this->threads[i].join();
+			for(size_t i = 0; i < this->queues.size(); i++)
+				delete this->queues[i];
+		}
+
+		/**
+		 * @brief Número de hilos worker
+		 */
+		size_t size() const
+		{
+			return(this->threads.size());
+		}
+
+		/**
+		 * @brief Encola fn(arg) dentro de group
+		 * Desde un worker va a su propia cola; desde fuera, a las colas por turnos
+		 */
+		void submit(task_group& group, task_fn fn, void* arg)
+		{
+			task t;
+			t.fn = fn;
+			t.arg = arg;
+			t.group = &group;
+			group.pending.fetch_add(1, std::memory_order_relaxed);
+			long self = this->currentIndex();
+			size_t target = (self >= 0) ? (size_t)self
+				: this->nextQueue.fetch_add(1) % this->queues.size();
+			{
+				std::lock_guard<std::mutex> guard(this->queues[target]->lock);
+				this->queues[target]->tasks.push_back(t);
+			}
+			{
+				std::lock_guard<std::mutex> guard(this->sleepLock);
+				this->queued++;
+			}
+			this->wake.notify_one();
+		}
+
+		/**
+		 * @brief Espera a que termine el grupo ejecutando tareas mientras tanto
+		 * @throw La primera excepción lanzada por una tarea del grupo
+		 */
+		void wait(task_group& group)
+		{
+			long self = this->currentIndex();
+			size_t& depth = helpDepth();
+			task t;
+			while(group.pending.load(std::memory_order_acquire) > 0)
+			{
+				if(this->take(self, t, depth < MAX_HELP_DEPTH))
+				{
+					depth++;
+					execute(t);
+					depth--;
+				}
+				else
+					std::this_thread::yield();
+			}
+			if(group.error)
+				std::rethrow_exception(group.error);
+		}
+};
+
+#endif
@@ -0,0 +1,231 @@
+#include "hash_bag.hpp"
+#include <iostream>
+
+// Con SSE2 (siempre presente en x86-64) un grupo de 16 bytes de control se
+// compara con una sola instrucción; si no, byte a byte
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+// ==================== CONSTRUCTORES Y DESTRUCTOR ====================
+
+hash_bag::hash_bag() {
+	ctrl = nullptr;
+	values = nullptr;
+	counts = nullptr;
+	capacity = 0;
+	used = 0;
+	size = 0;
+}
+
+hash_bag::hash_bag(const hash_bag &src) {
+	copy_from(src);
+}
+
+hash_bag &hash_bag::operator=(const hash_bag &src) {
+	if (this != &src) {
+		clear();
+		copy_from(src);
+	}
+	return *this;
+}
+
+hash_bag::~hash_bag() {
+	clear();
+}
+
+// ==================== MÉTODOS AUXILIARES ====================
+
+/**
+ * @brief Hash de un entero (finalizador de MurmurHash3)
+ * Los 7 bits bajos van al byte de control y el resto elige el grupo
+ */
+unsigned int hash_bag::hash(int value) {
+	unsigned int h = (unsigned int)value;
+	h ^= h >> 16;
+	h *= 0x85EBCA6Bu;
+	h ^= h >> 13;
+	h *= 0xC2B2AE35u;
+	h ^= h >> 16;
+	return h;
+}
+
+/**
+ * @brief Máscara con un bit por cada byte de control del grupo igual a byte
+ */
+unsigned int hash_bag::match(const unsigned char *group, unsigned char byte) {
+#if defined(__SSE2__)
+	__m128i ctrl_bytes = _mm_loadu_si128((const __m128i *)group);
+	__m128i eq = _mm_cmpeq_epi8(ctrl_bytes, _mm_set1_epi8((char)byte));
+	return (unsigned int)_mm_movemask_epi8(eq);
+#else
+	unsigned int mask = 0;
+	for (int i = 0; i < GROUP; i++) {
+		if (group[i] == byte)
+			mask |= 1u << i;
+	}
+	return mask;
+#endif
+}
+
+int hash_bag::lowest_bit(unsigned int mask) {
+#if defined(__GNUC__)
+	return __builtin_ctz(mask);
+#else
+	int i = 0;
+	while ((mask & 1u) == 0) {
+		mask >>= 1;
+		i++;
+	}
+	return i;
+#endif
+}
+
+/**
+ * @brief Busca el hueco de un valor
+ * Se recorren grupos enteros con paso triangular (1, 2, 3...), que con un
+ * número de grupos potencia de 2 acaba pasando por todos. En cada grupo solo
+ * se comparan los valores cuyo byte de control coincide; un grupo con algún
+ * hueco libre corta la búsqueda, porque nunca se borra nada suelto
+ */
+int hash_bag::find_slot(int value) const {
+	if (capacity == 0)
+		return -1;
+	unsigned int h = hash(value);
+	unsigned char tag = (unsigned char)(h & 0x7F);
+	unsigned int groups = (unsigned int)(capacity / GROUP);
+	unsigned int g = (h >> 7) & (groups - 1);
+	for (unsigned int step = 1; ; step++) {
+		int base = (int)g * GROUP;
+		unsigned int mask = match(ctrl + base, tag);
+		while (mask != 0) {
+			int slot = base + lowest_bit(mask);
+			if (values[slot] == value)
+				return slot;
+			mask &= mask - 1;
+		}
+		if (match(ctrl + base, EMPTY) != 0)
+			return -1;
+		g = (g + step) & (groups - 1);
+	}
+}
+
+/**
+ * @brief Coloca un valor que no está en la tabla (debe haber sitio)
+ * Sigue la misma secuencia de grupos que find_slot y ocupa el primer
+ * hueco libre que encuentra
+ */
+void hash_bag::place(int value, int count) {
+	unsigned int h = hash(value);
+	unsigned int groups = (unsigned int)(capacity / GROUP);
+	unsigned int g = (h >> 7) & (groups - 1);
+	for (unsigned int step = 1; ; step++) {
+		int base = (int)g * GROUP;
+		unsigned int mask = match(ctrl + base, EMPTY);
+		if (mask != 0) {
+			int slot = base + lowest_bit(mask);
+			ctrl[slot] = (unsigned char)(h & 0x7F);
+			values[slot] = value;
+			counts[slot] = count;
+			used++;
+			return;
+		}
+		g = (g + step) & (groups - 1);
+	}
+}
+
+/**
+ * @brief Duplica la capacidad (o crea la primera tabla) y recoloca los valores
+ */
+void hash_bag::grow() {
+	unsigned char *old_ctrl = ctrl;
+	int *old_values = values;
+	int *old_counts = counts;
+	int old_capacity = capacity;
+
+	capacity = (capacity == 0) ? GROUP : capacity * 2;
+	ctrl = new unsigned char[capacity];
+	values = new int[capacity];
+	counts = new int[capacity];
+	for (int i = 0; i < capacity; i++) {
+		ctrl[i] = EMPTY;
+	}
+	used = 0;
+	for (int i = 0; i < old_capacity; i++) {
+		if (old_ctrl[i] != EMPTY)
+			place(old_values[i], old_counts[i]);
+	}
+	delete[] old_ctrl;
+	delete[] old_values;
+	delete[] old_counts;
+}
+
+void hash_bag::copy_from(const hash_bag &src) {
+	capacity = src.capacity;
+	used = src.used;
+	size = src.size;
+	ctrl = nullptr;
+	values = nullptr;
+	counts = nullptr;
+	if (capacity == 0)
+		return;
+	ctrl = new unsigned char[capacity];
+	values = new int[capacity];
+	counts = new int[capacity];
+	for (int i = 0; i < capacity; i++) {
+		ctrl[i] = src.ctrl[i];
+		values[i] = src.values[i];
+		counts[i] = src.counts[i];
+	}
+}
+
+// ==================== MÉTODOS DE BAG ====================
+
+void hash_bag::insert(int item) {
+	int slot = find_slot(item);
+	if (slot >= 0) {
+		counts[slot]++;
+		size++;
+		return;
+	}
+	// Carga máxima de 7/8: siempre queda algún hueco libre que corta el sondeo
+	if ((used + 1) * 8 > capacity * 7)
+		grow();
+	place(item, 1);
+	size++;
+}
+
+void hash_bag::insert(int *items, int count) {
+	for (int i = 0; i < count; i++) {
+		insert(items[i]);
+	}
+}
+
+/**
+ * @brief Imprime cada valor tantas veces como se insertó
+ * El orden es el de los huecos de la tabla, no el de inserción
+ */
+void hash_bag::print() const {
+	for (int i = 0; i < capacity; i++) {
+		if (ctrl[i] == EMPTY)
+			continue;
+		for (int j = 0; j < counts[i]; j++) {
+			std::cout << values[i] << " ";
+		}
+	}
+	std::cout << std::endl;
+}
+
+void hash_bag::clear() {
+	if (ctrl != nullptr) {
+		delete[] ctrl;
+		delete[] values;
+		delete[] counts;
+		ctrl = nullptr;
+		values = nullptr;
+		counts = nullptr;
+	}
+	capacity = 0;
+	used = 0;
+	size = 0;
+}
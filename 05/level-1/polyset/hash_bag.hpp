@@ -0,0 +1,49 @@
+#pragma once
+
+#include "bag.hpp"
+
+/**
+ * @brief Implementación de bag usando una tabla hash de direccionamiento abierto
+ * Hereda de bag. Al estilo de las Swiss tables: los valores y sus contadores
+ * viven en arrays planos y cada hueco tiene además un byte de control (libre,
+ * o los 7 bits bajos del hash de su valor). Los huecos se agrupan de 16 en 16
+ * y la búsqueda compara los 16 bytes de control de un grupo a la vez (SSE2),
+ * así que casi nunca se mira un valor que no sea el buscado
+ */
+class hash_bag : virtual public bag
+{
+ protected:
+	static const int GROUP = 16;                // Huecos por grupo de sondeo
+	static const unsigned char EMPTY = 0x80;    // Control de un hueco libre
+
+	unsigned char *ctrl;    // Byte de control de cada hueco
+	int *values;            // Valor de cada hueco ocupado
+	int *counts;            // Repeticiones de cada valor (un bag admite duplicados)
+	int capacity;           // Huecos: potencia de 2 y múltiplo de GROUP (0 sin tabla)
+	int used;               // Huecos ocupados (valores distintos)
+	int size;               // Número de elementos, contando repeticiones
+
+	int find_slot(int) const;                       // Hueco del valor, -1 si no está
+
+ public:
+	// ==================== CONSTRUCTORES Y DESTRUCTOR ====================
+	hash_bag();                                     // Constructor por defecto
+	hash_bag(const hash_bag &);                     // Constructor de copia
+	hash_bag &operator=(const hash_bag &other);     // Operador de asignación
+	~hash_bag();                                    // Destructor
+
+	// ==================== MÉTODOS DE BAG ====================
+	void insert(int);                               // Insertar un elemento
+	void insert(int *, int);                        // Insertar array de elementos
+	void print() const;                             // Imprimir todos los elementos
+	void clear();                                   // Limpiar el bag
+
+ private:
+	// ==================== MÉTODOS AUXILIARES ====================
+	static unsigned int hash(int);                  // Mezcla los bits del valor
+	static unsigned int match(const unsigned char *, unsigned char); // Bytes iguales de un grupo
+	static int lowest_bit(unsigned int);            // Índice del bit más bajo a 1
+	void copy_from(const hash_bag &);               // Copia profunda de la tabla
+	void place(int, int);                           // Coloca un valor que no está
+	void grow();                                    // Duplica la tabla y recoloca
+};
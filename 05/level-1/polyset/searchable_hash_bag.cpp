@@ -0,0 +1,31 @@
+#include "searchable_hash_bag.hpp"
+
+
+searchable_hash_bag::searchable_hash_bag()
+{
+
+}
+
+searchable_hash_bag::searchable_hash_bag(const searchable_hash_bag& source) : hash_bag(source)
+{
+
+}
+
+searchable_hash_bag& searchable_hash_bag::operator=(const searchable_hash_bag& source)
+{
+	if(this != &source)
+	{
+		hash_bag::operator=(source);
+	}
+	return(*this);
+}
+
+bool searchable_hash_bag::has(int value) const
+{
+	return(this->find_slot(value) >= 0);
+}
+
+searchable_hash_bag::~searchable_hash_bag()
+{
+
+}
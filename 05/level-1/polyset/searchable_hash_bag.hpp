@@ -0,0 +1,15 @@
+#pragma once
+
+#include "hash_bag.hpp"
+#include "searchable_bag.hpp"
+
+
+class searchable_hash_bag : public hash_bag, public searchable_bag
+{
+	public:
+		searchable_hash_bag();
+		searchable_hash_bag(const searchable_hash_bag& source);
+		searchable_hash_bag& operator=(const searchable_hash_bag& source);
+		bool has(int) const;
+		~searchable_hash_bag();
+};
@@ -0,0 +1,168 @@
+#include "searchable_hash_bag.hpp"
+#include "set.hpp"
+
+#include <climits>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+/**
+ * @file test_hash_bag.cpp
+ * @brief Comprueba hash_bag / searchable_hash_bag contra un std::map
+ *
+ * Inserta secuencias pseudoaleatorias con muchos duplicados, negativos y
+ * los extremos de int, y compara has() y lo que imprime print() (como
+ * multiconjunto: el orden de la tabla no es el de inserción) con un
+ * std::map<int, int> de contadores. También prueba la copia, la
+ * asignación, clear() y set sobre un searchable_hash_bag.
+ *
+ * Compilar y ejecutar (código 1 si algo falla):
+ *     g++ -o test_hash_bag test_hash_bag.cpp hash_bag.cpp searchable_hash_bag.cpp set.cpp
+ *     ./test_hash_bag
+ */
+
+static int failures = 0;
+
+static void expect(bool ok, const char *what) {
+	if (!ok) {
+		std::cout << "FALLO " << what << std::endl;
+		failures++;
+	}
+}
+
+// ==================== REFERENCIA ====================
+
+/**
+ * @brief Lo que imprime print(), contado por valor
+ */
+static std::map<int, int> printed(const bag &b) {
+	std::ostringstream out;
+	std::streambuf *old = std::cout.rdbuf(out.rdbuf());
+	b.print();
+	std::cout.rdbuf(old);
+
+	std::map<int, int> counts;
+	std::istringstream in(out.str());
+	int value;
+	while (in >> value)
+		counts[value]++;
+	return counts;
+}
+
+/**
+ * @brief has() coincide con la referencia en los valores insertados y en
+ * sus vecinos (que pueden no estar)
+ */
+static void check_has(const searchable_hash_bag &b, const std::map<int, int> &ref, const char *what) {
+	bool ok = true;
+	for (std::map<int, int>::const_iterator it = ref.begin(); it != ref.end(); ++it) {
+		int v = it->first;
+		if (!b.has(v))
+			ok = false;
+		if (v != INT_MAX && b.has(v + 1) != (ref.count(v + 1) == 1))
+			ok = false;
+		if (v != INT_MIN && b.has(v - 1) != (ref.count(v - 1) == 1))
+			ok = false;
+	}
+	expect(ok, what);
+}
+
+// ==================== CASOS ====================
+
+/**
+ * @brief Inserciones sueltas y en array, con la tabla creciendo varias veces
+ */
+static void test_insert() {
+	static const int SIZES[] = { 0, 1, 15, 16, 17, 100, 1000, 100000 };
+	unsigned int seed = 42;
+	for (int s = 0; s < (int)(sizeof(SIZES) / sizeof(SIZES[0])); s++) {
+		searchable_hash_bag b;
+		std::map<int, int> ref;
+		int n = SIZES[s];
+		// Rango pequeño: muchos duplicados; rango amplio: casi todos distintos
+		unsigned int range = (s % 2 == 0) ? 64u : 0xFFFFFFFFu;
+		for (int i = 0; i < n; i++) {
+			seed = seed * 1664525u + 1013904223u;
+			int v = (int)(seed % range) - (range == 64u ? 32 : 0);
+			b.insert(v);
+			ref[v]++;
+		}
+		int extremes[] = { INT_MIN, INT_MAX, 0, -1, INT_MIN, INT_MAX };
+		b.insert(extremes, 6);
+		for (int i = 0; i < 6; i++)
+			ref[extremes[i]]++;
+
+		check_has(b, ref, "has() == referencia");
+		expect(printed(b) == ref, "print() == referencia");
+	}
+}
+
+/**
+ * @brief La copia y la asignación son profundas; clear() deja la tabla
+ * vacía y reutilizable
+ */
+static void test_copy() {
+	searchable_hash_bag a;
+	std::map<int, int> ref;
+	for (int i = 0; i < 500; i++) {
+		a.insert(i * 7 % 101);
+		ref[i * 7 % 101]++;
+	}
+
+	searchable_hash_bag copy(a);
+	searchable_hash_bag assigned;
+	assigned.insert(12345);
+	assigned = a;
+	a.insert(-5);
+	expect(printed(copy) == ref && !copy.has(-5), "la copia no ve cambios posteriores");
+	expect(printed(assigned) == ref && !assigned.has(12345), "la asignación reemplaza el contenido");
+
+	searchable_hash_bag &same = assigned;
+	assigned = same;
+	expect(printed(assigned) == ref, "autoasignación");
+
+	a.clear();
+	expect(printed(a).empty() && !a.has(0) && !a.has(-5), "clear() vacía la tabla");
+	a.insert(3);
+	a.insert(3);
+	std::map<int, int> three;
+	three[3] = 2;
+	expect(printed(a) == three && a.has(3), "reutilizable tras clear()");
+
+	searchable_hash_bag empty;
+	searchable_hash_bag empty_copy(empty);
+	expect(!empty_copy.has(0) && printed(empty_copy).empty(), "copia de una tabla vacía");
+}
+
+/**
+ * @brief set sobre searchable_hash_bag guarda cada valor una sola vez
+ */
+static void test_set() {
+	searchable_hash_bag b;
+	set s(b);
+	int data[] = { 5, 1, 5, 2, 1, 5, -3, 2 };
+	s.insert(data, 8);
+	s.insert(5);
+	std::map<int, int> ref;
+	ref[5] = 1;
+	ref[1] = 1;
+	ref[2] = 1;
+	ref[-3] = 1;
+	expect(printed(s.get_bag()) == ref, "set sin duplicados");
+	expect(s.has(-3) && !s.has(3), "set::has");
+	s.clear();
+	expect(!s.has(5) && printed(s.get_bag()).empty(), "set::clear");
+}
+
+int main() {
+	test_insert();
+	test_copy();
+	test_set();
+
+	if (failures != 0) {
+		std::cout << failures << " comprobaciones fallidas" << std::endl;
+		return 1;
+	}
+	std::cout << "hash_bag coincide con la referencia" << std::endl;
+	return 0;
+}